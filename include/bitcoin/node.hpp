@@ -16,8 +16,10 @@
 
 #include <bitcoin/database.hpp>
 #include <bitcoin/network.hpp>
+#include <bitcoin/node/batch_target.hpp>
 #include <bitcoin/node/block_arena.hpp>
 #include <bitcoin/node/block_memory.hpp>
+#include <bitcoin/node/capture_policy.hpp>
 #include <bitcoin/node/chase.hpp>
 #include <bitcoin/node/configuration.hpp>
 #include <bitcoin/node/define.hpp>
@@ -25,7 +27,10 @@
 #include <bitcoin/node/estimator.hpp>
 #include <bitcoin/node/events.hpp>
 #include <bitcoin/node/full_node.hpp>
+#include <bitcoin/node/height_bitmap.hpp>
 #include <bitcoin/node/settings.hpp>
+#include <bitcoin/node/speed_index.hpp>
+#include <bitcoin/node/validation_queue.hpp>
 #include <bitcoin/node/version.hpp>
 #include <bitcoin/node/channels/channel.hpp>
 #include <bitcoin/node/channels/channel_peer.hpp>
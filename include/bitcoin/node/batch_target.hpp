@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NODE_BATCH_TARGET_HPP
+#define LIBBITCOIN_NODE_BATCH_TARGET_HPP
+
+#include <atomic>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+/// Thread SAFE batch signature target, adapted by drains to a latency bound
+/// (drains are exclusive, so adaptation has one writer). Smaller batches
+/// measure lower rates, so the target is reduced toward the measured rate only
+/// when a drain exceeds the bound (hysteresis). Otherwise it probes back
+/// toward the configured maximum, recovering after a slow drain.
+class BCN_API batch_target
+{
+public:
+    DELETE_COPY_MOVE(batch_target);
+
+    /// The target starts at the maximum, and is not reduced below minimum.
+    batch_target(uint64_t maximum, uint64_t minimum) NOEXCEPT;
+
+    /// Current target signature count.
+    uint64_t get() const NOEXCEPT;
+
+    /// Adapt to signatures verified in milliseconds, against the latency
+    /// bound in milliseconds (zero disables). True if the target changed.
+    bool adapt(size_t signatures, size_t milliseconds,
+        size_t latency) NOEXCEPT;
+
+protected:
+    // These are thread safe.
+    const uint64_t maximum_;
+    const uint64_t minimum_;
+    std::atomic<uint64_t> target_;
+};
+
+} // namespace node
+} // namespace libbitcoin
+
+#endif
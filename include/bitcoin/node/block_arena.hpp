@@ -19,19 +19,43 @@
 #ifndef LIBBITCOIN_NODE_BLOCK_ARENA_HPP
 #define LIBBITCOIN_NODE_BLOCK_ARENA_HPP
 
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
 #include <bitcoin/node/define.hpp>
 
 namespace libbitcoin {
 namespace node {
 
-/// Thread UNSAFE detachable linked-linear memory arena.
+/// Detachable linked-linear memory arena. Allocation (start, allocate and
+/// detach) is thread UNSAFE, performed by one (owning) thread. Release, trim,
+/// idle and statistics are thread SAFE, as blocks may be released by any
+/// thread.
 class BCN_API block_arena
   : public arena
 {
 public:
+    /// Cumulative allocation statistics (approximate across threads).
+    struct statistics
+    {
+        size_t allocations{};
+        size_t chunks{};
+        size_t bytes{};
+        size_t slack{};
+        size_t padding{};
+        size_t peak{};
+    };
+
     DELETE_COPY(block_arena);
-    
-    block_arena(size_t multiple) NOEXCEPT;
+
+    /// Chunks of at least a hugepage are mapped (linux only) and first touched
+    /// by the allocating thread, which places them on that thread's numa node.
+    /// Smaller chunks are allocated. Recycled chunks are retained on release
+    /// for reuse by start/push, bounded by the high-water count of live chunks
+    /// (hugepages imply recycle, so the arena keeps a per-thread pool).
+    block_arena(size_t multiple, bool hugepages=false,
+        bool recycle=false) NOEXCEPT;
     block_arena(block_arena&& other) NOEXCEPT;
     virtual ~block_arena() NOEXCEPT;
 
@@ -46,7 +70,39 @@ public:
     /// Release all chunks chained to the address.
     void release(void* address) NOEXCEPT override;
 
+    /// Free all retained chunks and reset the high-water mark.
+    void trim() NOEXCEPT;
+
+    /// True if no detached allocation remains unreleased.
+    bool idle() const NOEXCEPT;
+
+    /// Allocation statistics (thread safe).
+    statistics get_statistics() const NOEXCEPT;
+
 protected:
+    /// Recycled chunk size granularity and (hidden) size header.
+    static constexpr size_t hugepage_size = 2u * 1024u * 1024u;
+    static constexpr size_t base_page_size = 4u * 1024u;
+    static constexpr size_t chunk_granularity = 64u * 1024u;
+    static constexpr size_t chunk_offset = alignof(std::max_align_t);
+
+    /// Upper bound on retained (released) chunks per arena.
+    static constexpr size_t maximum_chunks = 64;
+
+    /// First chunk sizing histogram of allocation to wire size ratios, in
+    /// 1/ratio_scale steps. Counts halve at decay_samples (moving window).
+    static constexpr size_t ratio_scale = 8;
+    static constexpr size_t ratio_buckets = 64 * ratio_scale;
+    static constexpr size_t minimum_samples = 32;
+    static constexpr size_t decay_samples = 4096;
+    static constexpr size_t ratio_percentile = 99;
+
+    /// First chunk size, at the ratio percentile once sampled (or multiple).
+    size_t first_size(size_t wire_size) const NOEXCEPT;
+
+    /// Record the allocation ratio and statistics of a finalized allocation.
+    void sample(size_t allocation) NOEXCEPT;
+
     /// Determine alignment offset.
     static constexpr size_t to_aligned(size_t value, size_t align) NOEXCEPT
     {
@@ -61,6 +117,9 @@ protected:
     /// Malloc throws if memory is not allocated.
     virtual INLINE ALLOCATOR void* malloc_(size_t bytes) THROWS
     {
+        if (recycle_)
+            return acquire(bytes);
+
         BC_PUSH_WARNING(NO_MALLOC_OR_FREE)
         return std::malloc(bytes);
         BC_POP_WARNING()
@@ -69,11 +128,29 @@ protected:
     /// Free does not throw, behavior is undefined if address is incorrect.
     virtual INLINE void free_(void* address) NOEXCEPT
     {
+        if (recycle_)
+        {
+            retain(address);
+            return;
+        }
+
         BC_PUSH_WARNING(NO_MALLOC_OR_FREE)
         std::free(address);
         BC_POP_WARNING()
     }
 
+    /// Obtain a retained or new recycleable chunk (nullptr on fail).
+    void* acquire(size_t bytes) NOEXCEPT;
+
+    /// Usable bytes of a recycleable chunk (at least the acquired bytes).
+    static size_t chunk_capacity(const void* address) NOEXCEPT;
+
+    /// Retain the chunk for reuse, or discard it if retention is full.
+    void retain(void* address) NOEXCEPT;
+
+    /// Free (or unmap) a recycleable chunk, by its header address.
+    void discard(uint8_t* chunk) NOEXCEPT;
+
     /// Link a memory chunk to the allocated stack.
     void push(size_t minimum=zero) THROWS;
 
@@ -108,12 +185,45 @@ protected:
     void do_deallocate(void* ptr, size_t bytes, size_t align) NOEXCEPT override;
     bool do_is_equal(const arena& other) const NOEXCEPT override;
 
-    // These are unprotected, caller must guard.
+    // These are unprotected, owning thread only.
     uint8_t* memory_map_;
     size_t multiple_;
     size_t offset_;
     size_t total_;
     size_t size_;
+    size_t pushed_;
+    size_t allocated_;
+    size_t padded_;
+    uint8_t* first_;
+    size_t wire_size_;
+    size_t samples_;
+    bool hugepages_;
+    bool recycle_;
+    std::array<uint32_t, ratio_buckets> histogram_;
+
+    /// A detached allocation, until released.
+    struct detached
+    {
+        void* address;
+        size_t bytes;
+        size_t chunks;
+    };
+
+    // These are protected by mutex (released by any thread).
+    mutable std::mutex mutex_;
+    size_t live_;
+    size_t live_chunks_;
+    size_t high_water_;
+    std::vector<uint8_t*> chunks_;
+    std::vector<detached> outstanding_;
+
+    // These are thread safe.
+    std::atomic_size_t allocations_;
+    std::atomic_size_t pushes_;
+    std::atomic_size_t bytes_;
+    std::atomic_size_t slack_;
+    std::atomic_size_t padding_;
+    std::atomic_size_t peak_;
 };
 
 } // namespace node
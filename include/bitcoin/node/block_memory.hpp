@@ -20,6 +20,10 @@
 #define LIBBITCOIN_NODE_BLOCK_MEMORY_HPP
 
 #include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include <bitcoin/node/block_arena.hpp>
 #include <bitcoin/node/define.hpp>
 
@@ -34,18 +38,62 @@ public:
     DELETE_COPY_MOVE_DESTRUCT(block_memory);
 
     /// Per thread multiple of wire size for each linear allocation chunk.
-    /// Returns default_arena if multiple is zero or threads exceeded.
-    block_memory(size_t multiple, size_t threads) NOEXCEPT;
+    /// Returns default_arena if multiple is zero or arenas are exhausted.
+    /// Arenas are leased to threads, returned upon thread exit (once no
+    /// allocation is outstanding), and grown on demand up to twice the
+    /// pre-sized thread count.
+    /// Hugepage chunk backing is thread-local and numa-local (linux only).
+    /// Recycling retains released chunks in each arena for reuse.
+    block_memory(size_t multiple, size_t threads, bool hugepages=false,
+        bool recycle=false) NOEXCEPT;
 
     /// Each thread obtains an arena.
     arena* get_arena() NOEXCEPT override;
 
+    /// Free all retained chunks (arena chunk retention is thread safe).
+    void trim() NOEXCEPT;
+
+    /// Allocation statistics summed over all arenas (thread safe).
+    /// Peak is the sum of arena peaks (an upper bound on peak live bytes).
+    block_arena::statistics get_statistics() const NOEXCEPT;
+
+    /// Number of get_arena calls that fell back to default_arena.
+    size_t fallbacks() const NOEXCEPT;
+
 protected:
+    /// Arena slots, shared with leasing threads (which may outlive this).
+    struct registry
+    {
+        registry(size_t multiple, size_t threads, bool hugepages,
+            bool recycle) NOEXCEPT;
+
+        const uint64_t id_;
+        const size_t multiple_;
+        const size_t limit_;
+        const bool hugepages_;
+        const bool recycle_;
+
+        // These are protected by mutex (arenas are stable in deque).
+        std::mutex mutex_{};
+        std::deque<block_arena> arenas_{};
+        std::vector<block_arena*> unleased_{};
+        std::vector<block_arena*> retiring_{};
+    };
+
+    /// Arenas leased by a thread, returned upon thread exit.
+    class leases;
+
+    /// Lease an unleased (or new) arena, nullptr if exhausted.
+    static block_arena* lease(registry& slots) NOEXCEPT;
+
+    /// Return an arena to the unleased pool, or retire it until idle.
+    static void unlease(registry& slots, block_arena* arena) NOEXCEPT;
+
     // This is thread safe.
-    std::atomic_size_t count_{ zero };
+    std::atomic_size_t fallbacks_{ zero };
 
-    // This is protected by constructor init and thread_local indexation.
-    std::vector<block_arena> arenas_{};
+    // This is thread safe (registry is guarded by its mutex).
+    const std::shared_ptr<registry> registry_;
 };
 
 } // namespace node
@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NODE_CAPTURE_POLICY_HPP
+#define LIBBITCOIN_NODE_CAPTURE_POLICY_HPP
+
+#include <atomic>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+/// Thread SAFE signature capture policy by height range. Capture is skipped
+/// for a range when the miss ratio of the prior range reached the percentage.
+/// Validations are concurrent and unordered, so the range only advances, and
+/// heights (and samples) of older ranges do not affect the decision.
+class BCN_API capture_policy
+{
+public:
+    /// Prior range statistics, set when a height advances the range.
+    struct report
+    {
+        bool advanced{};
+        bool changed{};
+        size_t missed{};
+        size_t total{};
+    };
+
+    DELETE_COPY_MOVE(capture_policy);
+
+    /// A zero percent disables skipping.
+    capture_policy(size_t miss_percent, size_t range=1'000,
+        size_t minimum=10'000) NOEXCEPT;
+
+    /// Count signatures captured or missed at height.
+    void captured(size_t height, size_t count) NOEXCEPT;
+    void missed(size_t height, size_t count) NOEXCEPT;
+
+    /// True if capture is skipped at height.
+    bool skip(size_t height, report& out) NOEXCEPT;
+
+protected:
+    /// One-based range of height, zero is no range.
+    size_t to_range(size_t height) const NOEXCEPT;
+
+    // These are thread safe.
+    const size_t percent_;
+    const size_t range_;
+    const size_t minimum_;
+    std::atomic_size_t current_{};
+    std::atomic_size_t captured_{};
+    std::atomic_size_t missed_{};
+    std::atomic_bool skipped_{};
+};
+
+} // namespace node
+} // namespace libbitcoin
+
+#endif
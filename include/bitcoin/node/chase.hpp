@@ -123,6 +123,10 @@ enum class chase
     /// Issued by 'validate' and handled by 'check', 'confirm', 'snapshot'.
     valid,
 
+    /// A batch of blocks has become valid, in place of each valid (count_t).
+    /// Issued by 'validate' and handled by 'check', 'confirm'.
+    valids,
+
     /// A checked block has failed validation (header_t).
     /// Issued by 'validate' and handled by 'organize'.
     unvalid,
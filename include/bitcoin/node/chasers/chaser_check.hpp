@@ -20,9 +20,13 @@
 #define LIBBITCOIN_NODE_CHASERS_CHASER_CHECK_HPP
 
 #include <deque>
+#include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 #include <bitcoin/node/chasers/chaser.hpp>
 #include <bitcoin/node/define.hpp>
+#include <bitcoin/node/height_bitmap.hpp>
+#include <bitcoin/node/speed_index.hpp>
 
 namespace libbitcoin {
 namespace node {
@@ -54,10 +58,18 @@ public:
 
     /// Interface for protocols to obtain/return pending download identifiers.
     /// Identifiers not downloaded must be returned or chain will remain gapped.
-    virtual void get_hashes(map_handler&& handler) NOEXCEPT;
+    /// Work is sized by the channel's speed relative to the mean speed.
+    virtual void get_hashes(object_key channel,
+        map_handler&& handler) NOEXCEPT;
     virtual void put_hashes(const map_ptr& map,
         network::result_handler&& handler) NOEXCEPT;
 
+    /// Claim an unassociated block for storage, false if stored or claimed.
+    /// Endgame duplicates may arrive concurrently, first claim wins. A claim
+    /// must be released once its storage has been attempted (thread safe).
+    virtual bool claim_block(const database::header_link& link) NOEXCEPT;
+    virtual void release_block(const database::header_link& link) NOEXCEPT;
+
 protected:
     virtual void handle_purged(const code& ec) NOEXCEPT;
     virtual bool handle_chase(const code& ec, chase event_,
@@ -67,10 +79,12 @@ protected:
     virtual void do_bump(height_t height) NOEXCEPT;
     virtual void do_checked(height_t height) NOEXCEPT;
     virtual void do_advanced(height_t height) NOEXCEPT;
+    virtual void do_advanced_count(count_t count) NOEXCEPT;
     virtual void do_headers(height_t branch_point) NOEXCEPT;
     virtual void do_regressed(height_t branch_point) NOEXCEPT;
     virtual void do_handle_purged(const code& ec) NOEXCEPT;
-    virtual void do_get_hashes(const map_handler& handler) NOEXCEPT;
+    virtual void do_get_hashes(object_key channel,
+        const map_handler& handler) NOEXCEPT;
     virtual void do_put_hashes(const map_ptr& map,
         const network::result_handler& handler) NOEXCEPT;
 
@@ -81,11 +95,16 @@ protected:
 
 private:
     static constexpr size_t minimum_for_standard_deviation = 4;
-    typedef std::unordered_map<object_key, double> speeds;
+    static constexpr double minimum_weight = 0.25;
+    static constexpr double maximum_weight = 4.0;
+    static constexpr size_t maximum_endgame_issues = 3;
     typedef std::deque<map_ptr> maps;
 
-    map_ptr get_map() NOEXCEPT;
+    map_ptr get_map(object_key channel) NOEXCEPT;
+    double get_weight(object_key channel) const NOEXCEPT;
     size_t set_unassociated() NOEXCEPT;
+    bool is_window_open() const NOEXCEPT;
+    bool set_endgame() NOEXCEPT;
     size_t get_inventory_size() const NOEXCEPT;
     bool set_map(const map_ptr& map) NOEXCEPT;
 
@@ -97,6 +116,7 @@ private:
     const float allowed_deviation_;
     const size_t maximum_concurrency_;
     const size_t maximum_height_;
+    const size_t endgame_;
     const size_t connections_;
     const size_t step_;
 
@@ -104,11 +124,16 @@ private:
     size_t inventory_{};
     size_t requested_{};
     size_t advanced_{};
+    size_t regressed_{ max_size_t };
+    height_bitmap associated_{};
     job::ptr job_{};
-
-    // TODO: optimize, default bucket count is around 8.
-    speeds speeds_{};
+    speed_index speeds_{};
     maps maps_{};
+    std::unordered_map<size_t, size_t> endgame_issues_{};
+
+    // These are protected by mutex.
+    std::mutex claims_mutex_{};
+    std::unordered_set<header_t> claims_{};
 };
 
 } // namespace node
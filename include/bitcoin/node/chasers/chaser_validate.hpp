@@ -20,8 +20,16 @@
 #define LIBBITCOIN_NODE_CHASERS_CHASER_VALIDATE_HPP
 
 #include <atomic>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <bitcoin/node/batch_target.hpp>
+#include <bitcoin/node/block_memory.hpp>
+#include <bitcoin/node/capture_policy.hpp>
 #include <bitcoin/node/chasers/chaser.hpp>
 #include <bitcoin/node/define.hpp>
+#include <bitcoin/node/validation_queue.hpp>
 
 namespace libbitcoin {
 namespace node {
@@ -46,6 +54,7 @@ protected:
     using header_links = database::header_links;
     using signatures = system::chain::signatures;
     using race = network::race_unity<const code&, const database::tx_link&>;
+    using jobs = std::vector<validation_queue::job>;
 
     /// Post a method in base or derived class in parallel (use PARALLEL).
     template <class Derived, typename Method, typename... Args>
@@ -64,8 +73,18 @@ protected:
     virtual void do_bump(height_t height) NOEXCEPT;
 
     /// Validation.
-    virtual void post_block(const header_link& link, bool bypass) NOEXCEPT;
+    virtual void post_block(const header_link& link, bool bypass,
+        size_t height) NOEXCEPT;
+    virtual void validate_queued() NOEXCEPT;
+    virtual void validate_tile(const jobs& tile) NOEXCEPT;
+    virtual void prefetch_blocks() NOEXCEPT;
+    virtual void prefetch_block(const header_link& link) NOEXCEPT;
+    virtual void touch_prevouts(const system::chain::block& block) NOEXCEPT;
     virtual void validate_block(const header_link& link, bool bypass) NOEXCEPT;
+    virtual system::chain::block::cptr take_block(
+        const header_link& link) NOEXCEPT;
+    virtual system::chain::block::cptr get_block(
+        const header_link& link) NOEXCEPT;
     virtual code validate(bool& batched, bool& capturing, bool bypass,
         const system::chain::block& block, const header_link& link,
         const system::chain::context& ctx) NOEXCEPT;
@@ -75,12 +94,13 @@ protected:
         size_t height, bool bypass, bool batched=false,
         bool capturing=false) NOEXCEPT;
     virtual void notify_block(const code& ec, size_t height,
-        const header_link& link, bool bypass, bool startup=false) NOEXCEPT;
+        const header_link& link, bool bypass, bool quiet=false) NOEXCEPT;
 
     /// Batching (lock-free, self-serviced by completing pool threads).
     /// Batch state is the store: sig tables carry rows, prevalid table
     /// carries the per-block link set (write-through, crash-durable).
     virtual code start_batch() NOEXCEPT;
+    virtual void do_resume_batch() NOEXCEPT;
     virtual void process_batch(bool residual) NOEXCEPT;
     virtual code do_process_batch(bool startup) NOEXCEPT;
     virtual bool mark_valids(header_links& prevalids, bool startup) NOEXCEPT;
@@ -110,15 +130,63 @@ private:
     };
 
     using missed = signatures::miss;
+    using ecdsa_rows = std::remove_cvref_t<decltype(signatures::ecdsa_rows())>;
+    using schnorr_rows =
+        std::remove_cvref_t<decltype(signatures::schnorr_rows())>;
+
+    // A batch table verification (records, result, and duration).
+    struct verification
+    {
+        size_t records{};
+        header_links invalids{};
+        bool completed{};
+        std::chrono::milliseconds elapsed{};
+    };
+
+    // Captures held during a drain, committed upon its completion.
+    struct parked
+    {
+        header_link link;
+        ecdsa_rows ecdsa;
+        schnorr_rows schnorr;
+    };
+
+    // Capture policy height range, and minimum signatures for its decision.
+    static constexpr size_t capture_range = 1'000;
+    static constexpr size_t minimum_samples = 10'000;
+
+    // Lower bound on an adapted batch target (signatures).
+    static constexpr uint64_t minimum_target = 10'000;
+
+    // Queued validations per pool post, and bound on queue capacity.
+    static constexpr size_t validation_quantum = 64;
+    static constexpr size_t maximum_queue = 65'536;
+
+    // Validation helpers.
+    void post_blocks(height_t height) NOEXCEPT;
+    void flush_tile() NOEXCEPT;
+    void validate_job(const validation_queue::job& job) NOEXCEPT;
+    void dequeued(size_t height) NOEXCEPT;
+    void clear_prefetched() NOEXCEPT;
+
+    // Memory statistics.
+    void do_stopping(const code& ec) NOEXCEPT;
+    void handle_memory_timer(const code& ec) NOEXCEPT;
 
     // Capture handlers.
     void do_log(const system::chain::script& missed) NOEXCEPT;
-    void do_fire(missed miss, size_t count) NOEXCEPT;
+    void do_fire(missed miss, size_t count, size_t height) NOEXCEPT;
 
     // Capture helpers.
-    signatures get_capture(const header_link& link) NOEXCEPT;
-    code commit_capture(bool& batched, const header_link& link) NOEXCEPT;
+    signatures get_capture(const header_link& link, size_t height) NOEXCEPT;
+    bool skip_capture(size_t height) NOEXCEPT;
+    code commit_capture(bool& batched, const header_link& link,
+        size_t height) NOEXCEPT;
     void clear_capture() NOEXCEPT;
+    void limit_capture() NOEXCEPT;
+    bool park_capture(const header_link& link) NOEXCEPT;
+    void commit_parked() NOEXCEPT;
+    void repark(parked&& capture) NOEXCEPT;
     void do_purge_capture() NOEXCEPT;
     std::string log_ratio(const std::string& name, size_t numerator,
         size_t denominator) const NOEXCEPT;
@@ -127,20 +195,54 @@ private:
     // Batching helpers.
     bool is_residual() NOEXCEPT;
     bool is_mature(bool residual) NOEXCEPT;
+    void verify_tables(verification& ecdsa,
+        verification& schnorr) NOEXCEPT;
+    void adapt_target(size_t signatures, size_t milliseconds) NOEXCEPT;
     std::string log_rate(const std::string& name, size_t signatures,
         size_t milliseconds) const NOEXCEPT;
 
-    // This is not thread safe.
+    // These are not thread safe.
     network::threadpool validation_threadpool_;
+    network::threadpool prefetch_threadpool_;
+
+    // This is thread safe (arenas are leased per thread, release is guarded).
+    block_memory validation_memory_;
+
+    // This is thread safe (lock-free, pushed only by strand).
+    validation_queue validation_queue_;
+
+    // This is thread safe (range only advances).
+    capture_policy capture_policy_;
+
+    // This is thread safe (adapted only under the drain claim).
+    batch_target adapted_target_;
+
+    // These are protected by strand.
+    network::deadline::ptr memory_timer_{};
+    std::deque<validation_queue::job> prefetches_{};
+    jobs tile_{};
+
+    // These are protected by mutex.
+    std::mutex parked_mutex_{};
+    std::vector<parked> parked_{};
+    size_t parked_rows_{};
+    std::mutex prefetch_mutex_{};
+    std::unordered_map<header_t, system::chain::block::cptr> prefetched_{};
 
     // These are thread safe.
     network::asio::strand validation_strand_;
     atomic_counter validate_backlog_{};
+    atomic_counter validators_{};
+    atomic_counter dequeued_{};
+    std::atomic_bool prefetching_{};
+    atomic_counter capture_peak_{};
+    atomic_counter capture_releases_{};
     std::atomic_bool disk_recovering_{};
     std::atomic_bool window_archived_{};
     std::atomic_bool maximum_posted_{};
     ////std::atomic_bool verifying_{};
     std::atomic_bool draining_{};
+    std::atomic_bool resuming_{};
     atomic_counter writers_{};
     counters counters_{};
     stopper stopping_{};
@@ -151,7 +253,13 @@ private:
     const size_t silent_start_height_;
     const size_t maximum_backlog_;
     const size_t maximum_height_;
+    const size_t threads_;
+    const size_t prefetch_distance_;
+    const bool prefetch_enabled_;
+    const size_t tile_size_;
     const uint64_t batch_target_;
+    const uint64_t batch_latency_;
+    const uint64_t batch_thread_bytes_;
     const bool batch_enabled_;
     const bool node_witness_;
     const bool filter_;
@@ -66,6 +66,19 @@ enum events : uint8_t
     schnorr_secs,        // schnorr batch verify timespan in seconds.
     silent_secs,         // silent payment scan timespan in seconds.
 
+    /// Batch.
+    batch_resuming,      // startup batch drain begun (table records).
+    resume_secs,         // startup batch drain timespan in seconds.
+
+    /// Memory (sampled).
+    arena_bytes,         // validation arena bytes allocated (cumulative).
+    arena_chunks,        // validation arena chunks pushed (cumulative).
+    arena_padding,       // validation arena alignment padding bytes (cumulative).
+    arena_fallbacks,     // validation allocations outside arena (cumulative).
+    arena_peak,          // validation arena peak live bytes.
+    capture_peak,        // signature capture peak thread bytes.
+    capture_releases,    // signature capture thread releases (cumulative).
+
     unknown
 };
 
@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NODE_HEIGHT_BITMAP_HPP
+#define LIBBITCOIN_NODE_HEIGHT_BITMAP_HPP
+
+#include <deque>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+/// Thread UNSAFE bitmap of heights above a contiguous top height (base).
+/// Heights at or below the base are implicitly set. Words are dropped as the
+/// base advances, so size is bounded by the span of set heights above it.
+class BCN_API height_bitmap
+{
+public:
+    DELETE_COPY_MOVE(height_bitmap);
+
+    /// Empty bitmap with base of zero.
+    height_bitmap() NOEXCEPT;
+
+    /// Clear all heights above base.
+    void reset(size_t base) NOEXCEPT;
+
+    /// Set height, ignored if at or below base.
+    void set(size_t height) NOEXCEPT;
+
+    /// True if height is set (or at or below base).
+    bool get(size_t height) const NOEXCEPT;
+
+    /// Clear all heights above height (base is lowered to height if above).
+    void clear_above(size_t height) NOEXCEPT;
+
+    /// Advance base through contiguous set heights above it, return base.
+    size_t advance() NOEXCEPT;
+
+    /// The contiguous top height.
+    size_t base() const NOEXCEPT;
+
+    /// Count of heights above base, through top, that are not set.
+    size_t missing(size_t top) const NOEXCEPT;
+
+protected:
+    static constexpr size_t word_bits = 64;
+    using words = std::deque<uint64_t>;
+
+    // Bit (index % 64) of word (index / 64) is height (origin + 1 + index).
+    // The base is never below the origin, or at or above a full first word.
+    size_t origin_{};
+    size_t base_{};
+    words words_{};
+};
+
+} // namespace node
+} // namespace libbitcoin
+
+#endif
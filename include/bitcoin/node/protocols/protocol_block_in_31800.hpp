@@ -42,6 +42,7 @@ public:
         block_type_(session->network_settings().witness_node() ?
             type_id::witness_block : type_id::block),
         node_pruned_(session->network_settings().pruned_node()),
+        endgame_(to_bool(session->node_settings().endgame_blocks)),
         map_(chaser_check::empty_map()),
         network::tracker<protocol_block_in_31800>(session->log)
     {
@@ -76,6 +77,8 @@ protected:
         const network::messages::peer::block::cptr& message) NOEXCEPT;
 
 private:
+    bool handle_duplicate(const system::hash_digest& hash,
+        size_t height) NOEXCEPT;
     code identify(const system::chain::block_view& block,
         const system::chain::context& ctx, bool bypass) const NOEXCEPT;
 
@@ -94,6 +97,7 @@ private:
     const size_t top_checkpoint_height_;
     const type_id block_type_;
     const bool node_pruned_;
+    const bool endgame_;
 
     // These are protected by strand.
     map_ptr map_;
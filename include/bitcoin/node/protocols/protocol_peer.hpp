@@ -71,6 +71,12 @@ protected:
     virtual void put_hashes(const map_ptr& map,
         network::result_handler&& handler) NOEXCEPT;
 
+    /// Claim a downloaded block for storage, false if stored or claimed.
+    virtual bool claim_block(const database::header_link& link) NOEXCEPT;
+
+    /// Release a claimed block once its storage has been attempted.
+    virtual void release_block(const database::header_link& link) NOEXCEPT;
+
     /// Methods.
     /// -----------------------------------------------------------------------
 
@@ -47,11 +47,16 @@ public:
     virtual void organize(const system::chain::block::cptr& block,
         organize_handler&& handler) NOEXCEPT;
 
-    /// Manage download queue.
-    virtual void get_hashes(map_handler&& handler) NOEXCEPT;
+    /// Manage download queue (work is sized by channel performance).
+    virtual void get_hashes(object_key channel,
+        map_handler&& handler) NOEXCEPT;
     virtual void put_hashes(const map_ptr& map,
         network::result_handler&& handler) NOEXCEPT;
 
+    /// Claim a downloaded block for storage (endgame duplicates, first wins).
+    virtual bool claim_block(const database::header_link& link) NOEXCEPT;
+    virtual void release_block(const database::header_link& link) NOEXCEPT;
+
     /// Events.
     /// -----------------------------------------------------------------------
 
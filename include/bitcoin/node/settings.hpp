@@ -40,14 +40,24 @@ public:
     bool thread_priority;
     bool memory_priority;
     bool allow_overlapped;
+    bool allocation_hugepages;
+    bool allocation_recycle;
     float allowed_deviation;
     float minimum_fee_rate;
     float minimum_bump_rate;
     uint64_t batch_signatures;
+    uint64_t batch_thread_bytes;
+    uint16_t batch_latency_seconds;
+    uint16_t batch_miss_percent;
+    uint16_t allocation_multiple;
     uint16_t announcement_cache;
+    uint16_t prefetch_threads;
+    uint32_t prefetch_distance;
+    uint16_t validation_tile;
     uint16_t fee_estimate_horizon;
     uint32_t maximum_height;
     uint32_t maximum_concurrency;
+    uint32_t endgame_blocks;
     uint32_t silent_start_height;
     uint16_t sample_period_seconds;
     uint32_t currency_window_minutes;
@@ -64,6 +74,8 @@ public:
     virtual size_t fee_estimate_horizon_() const NOEXCEPT;
     virtual bool fee_estimate_enabled() const NOEXCEPT;
     virtual bool batch_signatures_enabled() const NOEXCEPT;
+    virtual bool allocation_enabled() const NOEXCEPT;
+    virtual bool prefetch_enabled() const NOEXCEPT;
     virtual network::steady_clock::duration sample_period() const NOEXCEPT;
     virtual network::wall_clock::duration currency_window() const NOEXCEPT;
     virtual network::processing_priority thread_priority_() const NOEXCEPT;
@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NODE_SPEED_INDEX_HPP
+#define LIBBITCOIN_NODE_SPEED_INDEX_HPP
+
+#include <map>
+#include <unordered_map>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+/// Thread UNSAFE index of channel speeds, ordered by speed, with running sums
+/// for constant time mean and variance and logarithmic time update/slowest.
+class BCN_API speed_index
+{
+public:
+    DELETE_COPY_MOVE(speed_index);
+
+    /// Empty index.
+    speed_index() NOEXCEPT;
+
+    /// Insert or update the speed of a channel.
+    void set(object_key channel, double speed) NOEXCEPT;
+
+    /// Remove the channel, false if not present.
+    bool erase(object_key channel) NOEXCEPT;
+
+    /// True if the channel is present.
+    bool contains(object_key channel) const NOEXCEPT;
+
+    /// Speed of the channel, zero if not present.
+    double speed(object_key channel) const NOEXCEPT;
+
+    /// Set the slowest channel, false if empty.
+    bool slowest(object_key& out) const NOEXCEPT;
+
+    /// Number of channels.
+    size_t size() const NOEXCEPT;
+    bool empty() const NOEXCEPT;
+
+    /// Sum, mean and sample variance of speeds (zero if not computable).
+    double sum() const NOEXCEPT;
+    double mean() const NOEXCEPT;
+    double variance() const NOEXCEPT;
+
+protected:
+    using order = std::multimap<double, object_key>;
+    using index = std::unordered_map<object_key, order::iterator>;
+
+    void add(double speed) NOEXCEPT;
+    void subtract(double speed) NOEXCEPT;
+
+    order order_{};
+    index index_{};
+    double sum_{};
+    double squares_{};
+};
+
+} // namespace node
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_NODE_VALIDATION_QUEUE_HPP
+#define LIBBITCOIN_NODE_VALIDATION_QUEUE_HPP
+
+#include <atomic>
+#include <memory>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+/// Thread SAFE bounded lock-free multiple producer multiple consumer queue
+/// of block validation jobs (sequenced ring buffer, no allocation once
+/// constructed).
+class BCN_API validation_queue
+{
+public:
+    struct job
+    {
+        database::header_link link{};
+        bool bypass{};
+        size_t height{};
+    };
+
+    DELETE_COPY_MOVE(validation_queue);
+
+    /// Capacity is rounded up to a power of two (minimum two).
+    validation_queue(size_t capacity) NOEXCEPT;
+
+    /// Enqueue a job, false if the queue is full.
+    bool push(const job& value) NOEXCEPT;
+
+    /// Dequeue the oldest job, false if the queue is empty.
+    bool pop(job& out) NOEXCEPT;
+
+    /// Number of jobs that can be queued.
+    size_t capacity() const NOEXCEPT;
+
+protected:
+    static constexpr size_t cache_line = 64;
+
+    /// Smallest power of two not less than capacity (minimum two).
+    static size_t to_size(size_t capacity) NOEXCEPT;
+
+    struct cell
+    {
+        std::atomic_size_t sequence{};
+        job value{};
+    };
+
+    // These are thread safe.
+    const size_t mask_;
+    const std::unique_ptr<cell[]> cells_;
+    alignas(cache_line) std::atomic_size_t head_{};
+    alignas(cache_line) std::atomic_size_t tail_{};
+};
+
+} // namespace node
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/node/batch_target.hpp>
+
+#include <algorithm>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+using namespace system;
+
+batch_target::batch_target(uint64_t maximum, uint64_t minimum) NOEXCEPT
+  : maximum_(maximum),
+    minimum_(std::min(minimum, maximum)),
+    target_(maximum)
+{
+}
+
+uint64_t batch_target::get() const NOEXCEPT
+{
+    return target_.load();
+}
+
+// Over the bound, the target is smoothed toward the signatures verifiable
+// within it at the measured rate. Within the bound, a quarter of the distance
+// to the maximum is recovered.
+bool batch_target::adapt(size_t signatures, size_t milliseconds,
+    size_t latency) NOEXCEPT
+{
+    if (is_zero(latency) || is_zero(signatures))
+        return false;
+
+    const auto prior = target_.load();
+    auto next = prior;
+    if (milliseconds > latency)
+    {
+        const auto rate = (signatures * 1000u) / milliseconds;
+        const auto fit = (rate * latency) / 1000u;
+        next = ((3u * prior) + fit) / 4u;
+    }
+    else if (prior < maximum_)
+    {
+        next = prior + ceilinged_divide(maximum_ - prior, 4u);
+    }
+
+    next = std::clamp(next, minimum_, maximum_);
+    target_.store(next);
+    return next != prior;
+}
+
+} // namespace node
+} // namespace libbitcoin
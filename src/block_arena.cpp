@@ -19,8 +19,14 @@
 #include <bitcoin/node/block_arena.hpp>
 
 #include <algorithm>
+#include <mutex>
+#include <utility>
 #include <bitcoin/node/define.hpp>
 
+#if defined(HAVE_LINUX)
+    #include <sys/mman.h>
+#endif
+
 namespace libbitcoin {
 namespace node {
 
@@ -29,12 +35,40 @@ using namespace system;
 // construct/destruct/assign
 // ----------------------------------------------------------------------------
 
-block_arena::block_arena(size_t multiple) NOEXCEPT
+#if defined(HAVE_LINUX)
+constexpr auto have_hugepages = true;
+#else
+constexpr auto have_hugepages = false;
+#endif
+
+block_arena::block_arena(size_t multiple, bool hugepages,
+    bool recycle) NOEXCEPT
   : memory_map_{ nullptr },
     multiple_{ multiple },
     offset_{ zero },
     total_{ zero },
-    size_{ zero }
+    size_{ zero },
+    pushed_{ zero },
+    allocated_{ zero },
+    padded_{ zero },
+    first_{ nullptr },
+    wire_size_{ zero },
+    samples_{ zero },
+    hugepages_{ hugepages && have_hugepages },
+    recycle_{ recycle || hugepages_ },
+    histogram_{},
+    mutex_{},
+    live_{ zero },
+    live_chunks_{ zero },
+    high_water_{ zero },
+    chunks_{},
+    outstanding_{},
+    allocations_{ zero },
+    pushes_{ zero },
+    bytes_{ zero },
+    slack_{ zero },
+    padding_{ zero },
+    peak_{ zero }
 {
 }
 
@@ -43,26 +77,71 @@ block_arena::block_arena(block_arena&& other) NOEXCEPT
     multiple_{ other.multiple_ },
     offset_{ other.offset_ },
     total_{ other.total_ },
-    size_{ other.size_ }
+    size_{ other.size_ },
+    pushed_{ other.pushed_ },
+    allocated_{ other.allocated_ },
+    padded_{ other.padded_ },
+    first_{ other.first_ },
+    wire_size_{ other.wire_size_ },
+    samples_{ other.samples_ },
+    hugepages_{ other.hugepages_ },
+    recycle_{ other.recycle_ },
+    histogram_{ other.histogram_ },
+    mutex_{},
+    live_{ other.live_ },
+    live_chunks_{ other.live_chunks_ },
+    high_water_{ other.high_water_ },
+    chunks_{ std::move(other.chunks_) },
+    outstanding_{ std::move(other.outstanding_) },
+    allocations_{ other.allocations_.load() },
+    pushes_{ other.pushes_.load() },
+    bytes_{ other.bytes_.load() },
+    slack_{ other.slack_.load() },
+    padding_{ other.padding_.load() },
+    peak_{ other.peak_.load() }
 {
     // Prevents free(memory_map_) as responsibility is passed to this object.
     other.memory_map_ = nullptr;
+    other.chunks_.clear();
 }
 
 block_arena::~block_arena() NOEXCEPT
 {
+    trim();
 }
 
 block_arena& block_arena::operator=(block_arena&& other) NOEXCEPT
 {
+    trim();
     memory_map_ = other.memory_map_;
     multiple_ = other.multiple_;
     offset_ = other.offset_;
     total_ = other.total_;
     size_ = other.size_;
+    pushed_ = other.pushed_;
+    allocated_ = other.allocated_;
+    padded_ = other.padded_;
+    first_ = other.first_;
+    wire_size_ = other.wire_size_;
+    samples_ = other.samples_;
+    hugepages_ = other.hugepages_;
+    recycle_ = other.recycle_;
+    histogram_ = other.histogram_;
+    live_ = other.live_;
+    live_chunks_ = other.live_chunks_;
+    high_water_ = other.high_water_;
+    chunks_ = std::move(other.chunks_);
+    outstanding_ = std::move(other.outstanding_);
+    allocations_.store(other.allocations_.load());
+    pushes_.store(other.pushes_.load());
+    bytes_.store(other.bytes_.load());
+    slack_.store(other.slack_.load());
+    padding_.store(other.padding_.load());
+    peak_.store(other.peak_.load());
 
     // Prevents free(memory_map_) as responsibility is passed to this object.
     other.memory_map_ = nullptr;
+    other.chunks_.clear();
     return *this;
 }
 
@@ -74,22 +153,56 @@ void* block_arena::start(size_t wire_size) THROWS
     if (is_multiply_overflow(wire_size, multiple_))
         throw allocation_exception{};
 
-    size_ = wire_size * multiple_;
+    size_ = first_size(wire_size);
+    wire_size_ = wire_size;
     memory_map_ = nullptr;
     offset_ = zero;
     total_ = zero;
+    pushed_ = zero;
+    allocated_ = zero;
+    padded_ = zero;
     push();
+    first_ = memory_map_;
     return memory_map_;
 }
 
 size_t block_arena::detach() NOEXCEPT
 {
+    const auto allocation = total_ + offset_;
+
+    {
+        std::unique_lock lock{ mutex_ };
+        if (!is_null(memory_map_))
+            sample(allocation);
+
+        high_water_ = std::max(high_water_, live_chunks_);
+    }
+
     memory_map_ = nullptr;
-    return total_ + offset_;
+    return allocation;
 }
 
+// Chunks are returned to retention under the mutex, as the releasing thread
+// is not necessarily the owning (allocating) thread.
 void block_arena::release(void* address) NOEXCEPT
 {
+    std::unique_lock lock{ mutex_ };
+
+    // Untracked if not detached.
+    const auto it = std::ranges::find_if(outstanding_,
+        [=](const auto& allocation) NOEXCEPT
+        {
+            return allocation.address == address;
+        });
+
+    if (it != outstanding_.end())
+    {
+        live_ -= it->bytes;
+        live_chunks_ -= it->chunks;
+        *it = outstanding_.back();
+        outstanding_.pop_back();
+    }
+
     while (!is_null(address))
     {
         const auto link = get_link(pointer_cast<uint8_t>(address));
@@ -98,6 +211,35 @@ void block_arena::release(void* address) NOEXCEPT
     }
 }
 
+void block_arena::trim() NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    for (const auto chunk: chunks_)
+        discard(chunk);
+
+    chunks_.clear();
+    high_water_ = zero;
+}
+
+bool block_arena::idle() const NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    return outstanding_.empty();
+}
+
+block_arena::statistics block_arena::get_statistics() const NOEXCEPT
+{
+    return
+    {
+        .allocations = allocations_.load(std::memory_order_relaxed),
+        .chunks = pushes_.load(std::memory_order_relaxed),
+        .bytes = bytes_.load(std::memory_order_relaxed),
+        .slack = slack_.load(std::memory_order_relaxed),
+        .padding = padding_.load(std::memory_order_relaxed),
+        .peak = peak_.load(std::memory_order_relaxed)
+    };
+}
+
 // protected
 // ----------------------------------------------------------------------------
 
@@ -113,6 +255,10 @@ void block_arena::push(size_t minimum) THROWS
     if (is_null(map))
         throw allocation_exception{};
 
+    // Recycleable chunks are rounded up to whole units, so use all of it.
+    if (recycle_)
+        size_ = chunk_capacity(map);
+
     // Set previous chunk's link pointer to the new allocation.
     set_link(map);
     memory_map_ = map;
@@ -121,8 +267,215 @@ void block_arena::push(size_t minimum) THROWS
     set_link(nullptr);
     total_ += offset_;
     offset_ = link_size;
+    allocated_ += size_;
+    ++pushed_;
+}
+
+// protected sizing
+// ----------------------------------------------------------------------------
+
+size_t block_arena::first_size(size_t wire_size) const NOEXCEPT
+{
+    if (samples_ < minimum_samples)
+        return wire_size * multiple_;
+
+    // Smallest ratio that covers the percentile of sampled allocations.
+    const auto target = ceilinged_divide(samples_ * ratio_percentile, 100u);
+    auto count = zero;
+    auto bucket = zero;
+    for (; bucket < sub1(ratio_buckets); ++bucket)
+    {
+        count += histogram_.at(bucket);
+        if (count >= target)
+            break;
+    }
+
+    // Bucket is the ratio in 1/ratio_scale steps (rounded up when sampled).
+    if (is_multiply_overflow(wire_size, bucket))
+        return wire_size * multiple_;
+
+    return ceilinged_divide(wire_size * bucket, ratio_scale);
+}
+
+// Called under mutex (outstanding and live are shared with release).
+void block_arena::sample(size_t allocation) NOEXCEPT
+{
+    allocations_.fetch_add(one, std::memory_order_relaxed);
+    pushes_.fetch_add(pushed_, std::memory_order_relaxed);
+    bytes_.fetch_add(allocation, std::memory_order_relaxed);
+    slack_.fetch_add(floored_subtract(allocated_, allocation),
+        std::memory_order_relaxed);
+    padding_.fetch_add(padded_, std::memory_order_relaxed);
+
+    // Live chunk bytes are tracked from detach until release.
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    outstanding_.push_back({ first_, allocated_, pushed_ });
+    BC_POP_WARNING()
+    live_ += allocated_;
+    live_chunks_ += pushed_;
+    if (live_ > peak_.load(std::memory_order_relaxed))
+        peak_.store(live_, std::memory_order_relaxed);
+
+    if (is_zero(wire_size_) || is_multiply_overflow(allocation, ratio_scale))
+        return;
+
+    const auto ratio = ceilinged_divide(allocation * ratio_scale, wire_size_);
+    ++histogram_.at(std::min(ratio, sub1(ratio_buckets)));
+
+    // Halve all counts to weight recent allocations (moving histogram).
+    if (++samples_ == decay_samples)
+    {
+        samples_ = zero;
+        for (auto& count: histogram_)
+            samples_ += (count /= 2u);
+    }
+}
+
+// protected recycling
+// ----------------------------------------------------------------------------
+// Each recycleable chunk is prefixed by its size, padded to max alignment.
+
+// Round value up to a power of two alignment (not limited to max_align_t).
+static constexpr uintptr_t to_aligned_up(uintptr_t value,
+    size_t align) NOEXCEPT
+{
+    return (value + sub1(align)) & ~uintptr_t{ sub1(align) };
+}
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+BC_PUSH_WARNING(NO_MALLOC_OR_FREE)
+
+void* block_arena::acquire(size_t bytes) NOEXCEPT
+{
+    if (is_add_overflow(bytes, chunk_offset + sub1(hugepage_size)))
+        return nullptr;
+
+    // Round up to whole units, so that chunks are interchangeable. Chunks
+    // smaller than a hugepage are not mapped, as a mapping commits a full
+    // hugepage regardless of chunk size.
+    const auto rounded = [=](size_t unit) NOEXCEPT
+    {
+        return ((bytes + chunk_offset + sub1(unit)) / unit) * unit;
+    };
+
+    auto size = rounded(chunk_granularity);
+    const auto mapped = hugepages_ && size >= hugepage_size;
+    if (mapped)
+        size = rounded(hugepage_size);
+
+    // Reuse the first retained chunk of sufficient size.
+    {
+        std::unique_lock lock{ mutex_ };
+        const auto it = std::ranges::find_if(chunks_, [=](auto chunk) NOEXCEPT
+        {
+            return reinterpret_cast<size_t&>(*chunk) >= size;
+        });
+
+        if (it != chunks_.end())
+        {
+            const auto chunk = *it;
+            *it = chunks_.back();
+            chunks_.pop_back();
+            return chunk + chunk_offset;
+        }
+    }
+
+    uint8_t* chunk{};
+    if (mapped)
+    {
+#if defined(HAVE_LINUX)
+        // Over-map by a hugepage so the chunk can be hugepage aligned, as
+        // mmap guarantees only base page alignment.
+        if (is_add_overflow(size, hugepage_size))
+            return nullptr;
+
+        const auto map = ::mmap(nullptr, size + hugepage_size,
+            PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (map == MAP_FAILED)
+            return nullptr;
+
+        // Unmap the unaligned head and the tail.
+        const auto base = pointer_cast<uint8_t>(map);
+        const auto address = reinterpret_cast<uintptr_t>(base);
+        const auto head = to_aligned_up(address, hugepage_size) - address;
+        if (is_nonzero(head))
+            ::munmap(base, head);
+
+        const auto tail = hugepage_size - head;
+        if (is_nonzero(tail))
+            ::munmap(base + head + size, tail);
+
+        // Advisory only, falls back to base pages when thp is unavailable.
+        chunk = base + head;
+        ::madvise(chunk, size, MADV_HUGEPAGE);
+
+        // First touch from the owning thread binds each page to its numa
+        // node under the default (local) memory policy. Every base page is
+        // touched, as thp may not back the chunk.
+        for (auto page = zero; page < size; page += base_page_size)
+            chunk[page] = 0x00;
+#endif
+    }
+    else
+    {
+        chunk = pointer_cast<uint8_t>(std::malloc(size));
+    }
+
+    if (is_null(chunk))
+        return nullptr;
+
+    reinterpret_cast<size_t&>(*chunk) = size;
+    return chunk + chunk_offset;
+}
+
+size_t block_arena::chunk_capacity(const void* address) NOEXCEPT
+{
+    const auto chunk = pointer_cast<const uint8_t>(address) - chunk_offset;
+    return reinterpret_cast<const size_t&>(*chunk) - chunk_offset;
 }
 
+// Called under mutex (by release).
+void block_arena::retain(void* address) NOEXCEPT
+{
+    if (is_null(address))
+        return;
+
+    // Bounded by the largest observed count of live chunks, which covers all
+    // allocations held concurrently by this thread (e.g. while prefetching).
+    const auto chunk = pointer_cast<uint8_t>(address) - chunk_offset;
+    if (chunks_.size() < std::min(high_water_, maximum_chunks))
+    {
+        chunks_.push_back(chunk);
+        return;
+    }
+
+    discard(chunk);
+}
+
+void block_arena::discard(uint8_t* chunk) NOEXCEPT
+{
+    // Only chunks of at least a hugepage are mapped (see acquire).
+    const auto size = reinterpret_cast<size_t&>(*chunk);
+    if (hugepages_ && size >= hugepage_size)
+    {
+#if defined(HAVE_LINUX)
+        ::munmap(chunk, size);
+#endif
+    }
+    else
+    {
+        std::free(chunk);
+    }
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+BC_POP_WARNING()
+BC_POP_WARNING()
+
 // protected interface
 // ----------------------------------------------------------------------------
 
@@ -142,6 +495,7 @@ void* block_arena::do_allocate(size_t bytes, size_t align) THROWS
     }
     else
     {
+        padded_ += padding;
         offset_ += allocation;
 
         BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
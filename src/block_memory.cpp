@@ -18,7 +18,12 @@
  */
 #include <bitcoin/node/block_memory.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 #include <bitcoin/node/define.hpp>
 
 namespace libbitcoin {
@@ -26,20 +31,177 @@ namespace node {
 
 BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 
-block_memory::block_memory(size_t multiple, size_t threads) NOEXCEPT
+// Registry ids are never reused, so a stale lease cannot match a new registry.
+static std::atomic<uint64_t> registries{};
+
+// A lease of an expired registry is skipped, as its arenas no longer exist.
+// Blocks of a returned arena may outlive the thread, so an arena with
+// outstanding allocations is retired until idle (see lease).
+class block_memory::leases
 {
-    if (is_nonzero(multiple))
+public:
+    struct lease
+    {
+        uint64_t id;
+        std::weak_ptr<registry> slots;
+        block_arena* arena;
+    };
+
+    ~leases() NOEXCEPT
+    {
+        for (const auto& lease: leases_)
+        {
+            if (const auto slots = lease.slots.lock())
+                unlease(*slots, lease.arena);
+        }
+    }
+
+    block_arena* find(uint64_t id) const NOEXCEPT
     {
-        arenas_.reserve(threads);
-        for (auto index = zero; index < threads; ++index)
-            arenas_.emplace_back(multiple);
+        for (const auto& lease: leases_)
+            if (lease.id == id)
+                return lease.arena;
+
+        return nullptr;
     }
+
+    void add(lease&& value) NOEXCEPT
+    {
+        // Prune leases of expired registries.
+        std::erase_if(leases_, [](const auto& lease) NOEXCEPT
+        {
+            return lease.slots.expired();
+        });
+
+        leases_.push_back(std::move(value));
+    }
+
+private:
+    std::vector<lease> leases_{};
+};
+
+block_memory::registry::registry(size_t multiple, size_t threads,
+    bool hugepages, bool recycle) NOEXCEPT
+  : id_(registries.fetch_add(one, std::memory_order_relaxed)),
+    multiple_(multiple),
+    limit_(is_zero(multiple) ? zero : two * threads),
+    hugepages_(hugepages),
+    recycle_(recycle)
+{
+    for (auto index = zero; index < std::min(threads, limit_); ++index)
+    {
+        arenas_.emplace_back(multiple_, hugepages_, recycle_);
+        unleased_.push_back(&arenas_.back());
+    }
+
+    // Lease in construction order.
+    std::ranges::reverse(unleased_);
+}
+
+block_memory::block_memory(size_t multiple, size_t threads, bool hugepages,
+    bool recycle) NOEXCEPT
+  : registry_(std::make_shared<registry>(multiple, threads, hugepages,
+      recycle))
+{
 }
 
 arena* block_memory::get_arena() NOEXCEPT
 {
-    thread_local auto thread = count_.fetch_add(one, std::memory_order_relaxed);
-    return thread < arenas_.size() ? &arenas_.at(thread) : default_arena::get();
+    // Shared by all instances, keyed by registry id.
+    thread_local leases thread_leases{};
+
+    if (const auto arena = thread_leases.find(registry_->id_))
+        return arena;
+
+    if (is_zero(registry_->limit_))
+        return default_arena::get();
+
+    const auto arena = lease(*registry_);
+    if (is_null(arena))
+    {
+        fallbacks_.fetch_add(one, std::memory_order_relaxed);
+        return default_arena::get();
+    }
+
+    thread_leases.add({ registry_->id_, registry_, arena });
+    return arena;
+}
+
+void block_memory::trim() NOEXCEPT
+{
+    std::unique_lock lock{ registry_->mutex_ };
+    for (auto& arena: registry_->arenas_)
+        arena.trim();
+}
+
+block_arena::statistics block_memory::get_statistics() const NOEXCEPT
+{
+    block_arena::statistics total{};
+    std::unique_lock lock{ registry_->mutex_ };
+    for (const auto& arena: registry_->arenas_)
+    {
+        const auto statistics = arena.get_statistics();
+        total.allocations += statistics.allocations;
+        total.chunks += statistics.chunks;
+        total.bytes += statistics.bytes;
+        total.slack += statistics.slack;
+        total.padding += statistics.padding;
+        total.peak += statistics.peak;
+    }
+
+    return total;
+}
+
+size_t block_memory::fallbacks() const NOEXCEPT
+{
+    return fallbacks_.load(std::memory_order_relaxed);
+}
+
+// protected
+block_arena* block_memory::lease(registry& slots) NOEXCEPT
+{
+    std::unique_lock lock{ slots.mutex_ };
+
+    // Retired arenas become leasable once all of their blocks are released.
+    std::erase_if(slots.retiring_, [&](block_arena* arena) NOEXCEPT
+    {
+        if (!arena->idle())
+            return false;
+
+        arena->trim();
+        slots.unleased_.push_back(arena);
+        return true;
+    });
+
+    if (!slots.unleased_.empty())
+    {
+        const auto arena = slots.unleased_.back();
+        slots.unleased_.pop_back();
+        return arena;
+    }
+
+    // Grow under contention (deque growth does not move leased arenas).
+    if (slots.arenas_.size() < slots.limit_)
+    {
+        slots.arenas_.emplace_back(slots.multiple_, slots.hugepages_,
+            slots.recycle_);
+        return &slots.arenas_.back();
+    }
+
+    return nullptr;
+}
+
+void block_memory::unlease(registry& slots, block_arena* arena) NOEXCEPT
+{
+    std::unique_lock lock{ slots.mutex_ };
+    if (arena->idle())
+    {
+        arena->trim();
+        slots.unleased_.push_back(arena);
+        return;
+    }
+
+    slots.retiring_.push_back(arena);
 }
 
 BC_POP_WARNING()
@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/node/capture_policy.hpp>
+
+#include <algorithm>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+using namespace system;
+
+capture_policy::capture_policy(size_t miss_percent, size_t range,
+    size_t minimum) NOEXCEPT
+  : percent_(miss_percent),
+    range_(std::max(range, one)),
+    minimum_(minimum)
+{
+}
+
+void capture_policy::captured(size_t height, size_t count) NOEXCEPT
+{
+    if (to_range(height) == current_.load())
+        captured_ += count;
+}
+
+void capture_policy::missed(size_t height, size_t count) NOEXCEPT
+{
+    if (to_range(height) == current_.load())
+        missed_ += count;
+}
+
+// A skipped range has no samples, so the following range captures again
+// (probe), as miss ratios vary by range.
+bool capture_policy::skip(size_t height, report& out) NOEXCEPT
+{
+    if (is_zero(percent_))
+        return false;
+
+    const auto range = to_range(height);
+    auto prior = current_.load();
+    while (range > prior)
+    {
+        if (!current_.compare_exchange_weak(prior, range))
+            continue;
+
+        const auto captured = captured_.exchange(zero);
+        const auto missed = missed_.exchange(zero);
+        const auto total = captured + missed;
+        const auto skip = (total >= minimum_) &&
+            ((100u * missed) >= (percent_ * total));
+
+        out.advanced = true;
+        out.changed = (skip != skipped_.exchange(skip));
+        out.missed = missed;
+        out.total = total;
+        break;
+    }
+
+    return skipped_.load();
+}
+
+size_t capture_policy::to_range(size_t height) const NOEXCEPT
+{
+    return add1(height / range_);
+}
+
+} // namespace node
+} // namespace libbitcoin
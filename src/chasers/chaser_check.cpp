@@ -64,6 +64,8 @@ chaser_check::chaser_check(full_node& node) NOEXCEPT
     allowed_deviation_(node.node_settings().allowed_deviation),
     maximum_concurrency_(node.node_settings().maximum_concurrency_()),
     maximum_height_(node.node_settings().maximum_height_()),
+    endgame_(std::min<size_t>(node.node_settings().endgame_blocks,
+        messages::peer::max_inventory)),
     connections_(get_target_connections(node.network_settings())),
     step_(get_step(connections_, maximum_concurrency_))
 {
@@ -90,12 +92,14 @@ map_ptr chaser_check::split(const map_ptr& map) NOEXCEPT
 
 // `position` tracks the contiguous chain of associated candidate blocks.
 // `requested` tracks the last height of the current download window.
-// `advanced` tracks `requested` less window blocks not yet validated.
+// `advanced` tracks the fork point plus the count of validated blocks.
+// The window slides, bounded by `maximum_concurrency` above `advanced`.
 code chaser_check::start() NOEXCEPT
 {
     start_tracking();
     set_position(archive().get_fork());
     requested_ = advanced_ = position();
+    associated_.reset(position());
     const auto added = set_unassociated();
     LOGN("Fork point (" << requested_ << ") unassociated (" << added << ").");
 
@@ -164,6 +168,12 @@ bool chaser_check::handle_chase(const code&, chase event_,
             POST(do_advanced, std::get<height_t>(value));
             break;
         }
+        case chase::valids:
+        {
+            BC_ASSERT(std::holds_alternative<count_t>(value));
+            POST(do_advanced_count, std::get<count_t>(value));
+            break;
+        }
         case chase::stop:
         {
             return false;
@@ -221,22 +231,18 @@ void chaser_check::do_starved(object_t self) NOEXCEPT
     BC_ASSERT(stranded());
 
     // Remove the starved channel to prevent self-selection.
-    if (speeds_.find(self) != speeds_.end())
-        speeds_.erase(self);
+    speeds_.erase(self);
 
-    // Find the slowest reporting channel.
-    const auto slowest = std::min_element(speeds_.begin(), speeds_.end(),
-        [](const auto& left, const auto& right) NOEXCEPT
-        {
-            return left.second < right.second;
-        });
+    // Endgame, remaining work is duplicated to idle channels (vs. split).
+    if (set_endgame())
+        return;
 
-    // Direct the slowest channel to split work and stop.
-    if (slowest != speeds_.end())
+    // Direct the slowest reporting channel to split work and stop.
+    object_key slow{};
+    if (speeds_.slowest(slow))
     {
         // Erase entry so less likely to be claimed again before stopping.
-        const auto slow = slowest->first;
-        speeds_.erase(slowest);
+        speeds_.erase(slow);
 
         // Notify slow channel to split itself (in favor of 'self' channel).
         notify_one(slow, error::success, chase::split, self);
@@ -292,7 +298,7 @@ void chaser_check::do_update(object_key channel, uint64_t speed,
 
     // Integer to floating point.
     const auto fast = to_floating(speed);
-    speeds_[channel] = fast;
+    speeds_.set(channel, fast);
 
     // Three elements are required to measure deviation, don't drop below.
     const auto count = speeds_.size();
@@ -302,23 +308,16 @@ void chaser_check::do_update(object_key channel, uint64_t speed,
         return;
     }
 
-    double sum = 0.0;
-    double sum_squares = 0.0;
-    for (const auto& element : speeds_)
-    {
-        sum += element.second;
-        sum_squares += std::pow(element.second, two);
-    }
-
-    const auto mean = sum / count;
+    // Running sums, constant time.
+    const auto sum = speeds_.sum();
+    const auto mean = speeds_.mean();
     if (fast >= mean)
     {
         handler(error::success);
         return;
     }
 
-    const auto variance = (sum_squares - (sum * sum) / count) / sub1(count);
-    const auto sdev = std::sqrt(variance);
+    const auto sdev = std::sqrt(speeds_.variance());
     const auto slow = (mean - fast) > (allowed_deviation_ * sdev);
 
     // Only speed < mean channels are logged.
@@ -344,12 +343,20 @@ void chaser_check::do_regressed(height_t branch_point) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
+    // Candidates above the branch point are replaced, as are their checks.
+    associated_.clear_above(branch_point);
+    regressed_ = std::min(regressed_, branch_point);
+    endgame_issues_.clear();
+
     // Inconsequential regression, work isn't there yet.
     if (branch_point >= position())
         return;
 
     // Update position, purge outstanding work, and wait on track completion.
+    // The window is rewound, as work above the branch point is purged.
     set_position(branch_point);
+    requested_ = std::min(requested_, branch_point);
+    advanced_ = std::min(advanced_, branch_point);
     stop_tracking();
     maps_.clear();
     notify(error::success, chase::purge, branch_point);
@@ -363,10 +370,23 @@ void chaser_check::do_advanced(height_t) NOEXCEPT
     BC_ASSERT(stranded());
 
     // Validations are not ordered, so accumulate vs. compare height.
+    const auto closed = !is_window_open();
     ++advanced_;
 
-    // The full count of requested hashes has been validated.
-    if (advanced_ == requested_)
+    // Validation has freed enough of the window to issue more work.
+    if (closed && is_window_open())
+        do_headers({});
+}
+
+void chaser_check::do_advanced_count(count_t count) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    // As do_advanced for each of count validations.
+    const auto closed = !is_window_open();
+    advanced_ += count;
+
+    if (closed && is_window_open())
         do_headers({});
 }
 
@@ -374,7 +394,18 @@ void chaser_check::do_checked(height_t height) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
+    // A check may be posted before a regression and arrive after it, in which
+    // case the height is no longer (or not yet again) an associated candidate.
+    // Only heights above an unpassed branch point are verified (store probe).
+    if (height > regressed_)
+    {
+        const auto& query = archive();
+        if (!query.is_associated(query.to_candidate(height)))
+            return;
+    }
+
     // Candidate block was checked at the given height, advance.
+    associated_.set(height);
     if (height == add1(position()))
         do_bump({});
 }
@@ -386,19 +417,32 @@ void chaser_check::do_bump(height_t) NOEXCEPT
         return;
 
     const auto& query = archive();
-    auto height = position();
 
-    // TODO: query.is_associated() is expensive (hashmap search).
-    // Skip checked blocks starting immediately after last checked.
-    while (!closed() && query.is_associated(query.to_candidate(++height)))
+    // Skip checked blocks starting immediately after last checked. Checked
+    // heights are skipped by word (bitmap), and the store is queried only at
+    // a gap, as blocks may be associated before startup or by prior branch.
+    while (!closed())
     {
+        const auto previous = position();
+        const auto height = associated_.advance();
         set_position(height);
 
         // Notify validator that no more blocks are coming.
-        if (height == requested_)
-            notify(error::success, chase::windowed, height);
+        if (previous < requested_ && height >= requested_)
+            notify(error::success, chase::windowed, requested_);
+
+        // query.is_associated() is expensive (hashmap search).
+        const auto next = add1(height);
+        if (!query.is_associated(query.to_candidate(next)))
+            break;
+
+        associated_.set(next);
     }
 
+    // Checks above the branch point are current once the position passes it.
+    if (position() > regressed_)
+        regressed_ = max_size_t;
+
     do_headers({});
 }
 
@@ -421,12 +465,13 @@ bool chaser_check::purging() const NOEXCEPT
     return !job_;
 }
 
-void chaser_check::get_hashes(map_handler&& handler) NOEXCEPT
+void chaser_check::get_hashes(object_key channel,
+    map_handler&& handler) NOEXCEPT
 {
     if (closed())
         return;
 
-    POST(do_get_hashes, std::move(handler));
+    POST(do_get_hashes, channel, std::move(handler));
 }
 
 void chaser_check::put_hashes(const map_ptr& map,
@@ -438,13 +483,36 @@ void chaser_check::put_hashes(const map_ptr& map,
     POST(do_put_hashes, map, std::move(handler));
 }
 
-void chaser_check::do_get_hashes(const map_handler& handler) NOEXCEPT
+bool chaser_check::claim_block(const header_link& link) NOEXCEPT
+{
+    {
+        std::unique_lock lock(claims_mutex_);
+        if (!claims_.insert(link.value).second)
+            return false;
+    }
+
+    // Tested under claim, as a prior claim is released only once stored.
+    if (!archive().is_associated(link))
+        return true;
+
+    release_block(link);
+    return false;
+}
+
+void chaser_check::release_block(const header_link& link) NOEXCEPT
+{
+    std::unique_lock lock(claims_mutex_);
+    claims_.erase(link.value);
+}
+
+void chaser_check::do_get_hashes(object_key channel,
+    const map_handler& handler) NOEXCEPT
 {
     BC_ASSERT(stranded());
     if (closed() || purging())
         return;
 
-    handler(error::success, get_map(), job_);
+    handler(error::success, get_map(channel), job_);
 }
 
 void chaser_check::do_put_hashes(const map_ptr& map,
@@ -455,6 +523,12 @@ void chaser_check::do_put_hashes(const map_ptr& map,
     if (closed() || purging())
         return;
 
+    // Drop returned work already checked (endgame duplicates).
+    auto& index = map->get<association::pos>();
+    for (auto it = index.begin(); it != index.end();)
+        it = associated_.get(it->context.height) ? index.erase(it) :
+            std::next(it);
+
     if (set_map(map))
         notify(error::success, chase::download, map->size());
 
@@ -464,10 +538,47 @@ void chaser_check::do_put_hashes(const map_ptr& map,
 // utilities
 // ----------------------------------------------------------------------------
 
-map_ptr chaser_check::get_map() NOEXCEPT
+// Maps are issued in height order, sized to the channel's relative speed.
+// A faster channel joins following maps, a slower one returns its excess.
+map_ptr chaser_check::get_map(object_key channel) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    if (maps_.empty())
+        return empty_map();
+
+    constexpr size_t maximum = messages::peer::max_inventory;
+    const auto map = pop_front(maps_);
+    const auto base = is_zero(inventory_) ? map->size() : inventory_;
+    const auto scaled = std::ceil(get_weight(channel) * to_floating(base));
+    const auto target = std::clamp(to_integer<size_t>(scaled), one, maximum);
+
+    while ((map->size() < target) && !maps_.empty())
+    {
+        const auto next = pop_front(maps_);
+        auto& index = next->get<association::pos>();
+        map->merge(index, index.begin(), index.end());
+    }
+
+    if (map->size() > target)
+    {
+        const auto excess = empty_map();
+        auto& index = map->get<association::pos>();
+        excess->merge(index, std::next(index.begin(), target), index.end());
+        maps_.push_front(excess);
+    }
+
+    return map;
+}
+
+// Ratio of channel speed to mean speed (bounded), one if not measurable.
+double chaser_check::get_weight(object_key channel) const NOEXCEPT
 {
     BC_ASSERT(stranded());
-    return maps_.empty() ? empty_map() : pop_front(maps_);
+    if (!speeds_.contains(channel) || speeds_.size() < two)
+        return 1.0;
+
+    const auto ratio = speeds_.speed(channel) / speeds_.mean();
+    return std::clamp(ratio, minimum_weight, maximum_weight);
 }
 
 bool chaser_check::set_map(const map_ptr& map) NOEXCEPT
@@ -492,12 +603,10 @@ size_t chaser_check::set_unassociated() NOEXCEPT
     if (closed() || purging())
         return {};
 
-    // Defer new work issuance until gaps filled.
-    if (position() < requested_)
-        return {};
-
-    // Defer new work until validation caught up to request.
-    if (advanced_ < requested_)
+    // Defer new work until validation has freed enough of the window.
+    // Gaps below requested do not defer work, so download and validation
+    // overlap and the pipeline does not drain between windows.
+    if (!is_window_open())
         return {};
 
     // Inventory size gets set only once.
@@ -506,12 +615,11 @@ size_t chaser_check::set_unassociated() NOEXCEPT
             return {};
 
     // Due to previous downloads, validation can race ahead of last request.
-    // The last request (requested_) stops at the last gap in the window, but
-    // validation continues until the next gap. Start next scan above validated
-    // not last requested, since all between are already downloaded.
+    // The window extends from last validated, and scanning resumes above the
+    // last request, since all at or below it have been issued.
     const auto& query = archive();
     const auto previous = requested_;
-    const auto step = ceilinged_add(position(), maximum_concurrency_);
+    const auto step = ceilinged_add(advanced_, maximum_concurrency_);
     const auto stop = std::min(step, maximum_height_);
     size_t count{};
 
@@ -531,7 +639,7 @@ size_t chaser_check::set_unassociated() NOEXCEPT
     LOGN("Advance by ("
         << maximum_concurrency_ << ") above ("
         << previous << ") from ("
-        << position() << ") stop ("
+        << advanced_ << ") stop ("
         << stop << ") found ("
         << count << ") last ("
         << requested_ << ").");
@@ -539,6 +647,65 @@ size_t chaser_check::set_unassociated() NOEXCEPT
     return count;
 }
 
+// The window reopens once validation frees half of it (hysteresis), which
+// limits store scans while keeping issued work ahead of validation.
+bool chaser_check::is_window_open() const NOEXCEPT
+{
+    const auto half = to_half(maximum_concurrency_);
+    return requested_ < ceilinged_add(advanced_, half);
+}
+
+// When outstanding work in the window falls to the endgame threshold, with no
+// unissued work, the unassociated remainder is issued again. The first block
+// arrival is stored, the other ignored by its channel as already associated.
+// Each height is issued at most maximum_endgame_issues times, as starved
+// channels would otherwise reissue the same stalled heights without bound.
+bool chaser_check::set_endgame() NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    if (is_zero(endgame_) || !maps_.empty() || closed() || purging())
+        return false;
+
+    const auto outstanding = associated_.missing(requested_);
+    if (is_zero(outstanding) || outstanding > endgame_)
+        return false;
+
+    // Calls query.is_associated() per block, bounded by the window remainder.
+    const auto& query = archive();
+    const auto map = std::make_shared<associations>(
+        query.get_unassociated_above(position(), endgame_, requested_));
+
+    // Issues at or below position are complete.
+    std::erase_if(endgame_issues_, [this](const auto& issue) NOEXCEPT
+    {
+        return issue.first <= position();
+    });
+
+    auto& index = map->get<association::pos>();
+    for (auto it = index.begin(); it != index.end();)
+    {
+        auto& issues = endgame_issues_[it->context.height];
+        if (issues < maximum_endgame_issues)
+        {
+            ++issues;
+            it = std::next(it);
+        }
+        else
+        {
+            it = index.erase(it);
+        }
+    }
+
+    if (!set_map(map))
+        return false;
+
+    LOGV("Endgame (" << map->size() << ") of (" << outstanding
+        << ") outstanding above (" << position() << ").");
+
+    notify(error::success, chase::download, map->size());
+    return true;
+}
+
 size_t chaser_check::get_inventory_size() const NOEXCEPT
 {
     if (is_zero(connections_) || !is_current_chain(false))
@@ -79,6 +79,13 @@ bool chaser_confirm::handle_chase(const code&, chase event_,
             POST(do_validated, std::get<height_t>(value));
             break;
         }
+        case chase::valids:
+        {
+            // value is count of validated blocks (batch), height not used.
+            BC_ASSERT(std::holds_alternative<count_t>(value));
+            POST(do_validated, height_t{});
+            break;
+        }
         case chase::regressed:
         case chase::disorganized:
         {
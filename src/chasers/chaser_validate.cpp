@@ -38,13 +38,30 @@ chaser_validate::chaser_validate(full_node& node) NOEXCEPT
   : chaser(node),
     validation_threadpool_(node.node_settings().threads_(),
         node.node_settings().thread_priority_()),
+    prefetch_threadpool_(node.node_settings().prefetch_threads,
+        node.node_settings().thread_priority_()),
+    validation_memory_(node.node_settings().allocation_multiple,
+        node.node_settings().threads_() + node.node_settings().prefetch_threads,
+        node.node_settings().allocation_hugepages,
+        node.node_settings().allocation_recycle),
+    validation_queue_(std::min(node.node_settings().maximum_concurrency_(),
+        maximum_queue)),
+    capture_policy_(node.node_settings().batch_miss_percent, capture_range,
+        minimum_samples),
+    adapted_target_(node.node_settings().batch_signatures, minimum_target),
     validation_strand_(validation_threadpool_.service().get_executor()),
     subsidy_interval_(node.system_settings().subsidy_interval_blocks),
     initial_subsidy_(node.system_settings().initial_subsidy()),
     silent_start_height_(node.node_settings().silent_start_height),
     maximum_backlog_(node.node_settings().maximum_concurrency_()),
     maximum_height_(node.node_settings().maximum_height_()),
+    threads_(node.node_settings().threads_()),
+    prefetch_distance_(node.node_settings().prefetch_distance),
+    prefetch_enabled_(node.node_settings().prefetch_enabled()),
+    tile_size_(node.node_settings().validation_tile),
     batch_target_(node.node_settings().batch_signatures),
+    batch_latency_(1000u * node.node_settings().batch_latency_seconds),
+    batch_thread_bytes_(node.node_settings().batch_thread_bytes),
     batch_enabled_(node.node_settings().batch_signatures_enabled()),
     node_witness_(node.network_settings().witness_node()),
     filter_(node.archive().filter_enabled())
@@ -60,6 +77,15 @@ code chaser_validate::start() NOEXCEPT
     if (const auto ec = start_batch())
         return fault(ec);
 
+    // Construct is too early to create the unstarted timer.
+    if (node_settings().allocation_enabled() &&
+        to_bool(node_settings().sample_period_seconds))
+    {
+        memory_timer_ = std::make_shared<network::deadline>(log, strand(),
+            node_settings().sample_period());
+        POST(handle_memory_timer, error::success);
+    }
+
     SUBSCRIBE_CHASE(handle_chase, _1, _2, _3);
     return error::success;
 }
@@ -183,6 +209,20 @@ void chaser_validate::do_bump(height_t) NOEXCEPT
 // ----------------------------------------------------------------------------
 
 void chaser_validate::do_bumped(height_t height) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    // Deferred until the startup drain completes (which bumps).
+    if (resuming_.load())
+        return;
+
+    post_blocks(height);
+    flush_tile();
+    prefetch_blocks();
+}
+
+// private
+void chaser_validate::post_blocks(height_t height) NOEXCEPT
 {
     BC_ASSERT(stranded());
     const auto& query = archive();
@@ -218,7 +258,7 @@ void chaser_validate::do_bumped(height_t height) NOEXCEPT
                 else
                 {
                     ++validate_backlog_;
-                    post_block(link, bypass);
+                    post_block(link, bypass, height);
                 }
                 break;
             }
@@ -246,11 +286,217 @@ void chaser_validate::do_bumped(height_t height) NOEXCEPT
     }
 }
 
-void chaser_validate::post_block(const header_link& link,
-    bool bypass) NOEXCEPT
+// Blocks are queued in height order and pulled by at most one validator per
+// pool thread, avoiding a handler allocation and wakeup for each block.
+void chaser_validate::post_block(const header_link& link, bool bypass,
+    size_t height) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    const validation_queue::job job{ link, bypass, height };
+
+    // Posted blocks are read ahead of their dequeue (see prefetch_blocks).
+    if (prefetch_enabled_)
+        prefetches_.push_back(job);
+
+    // Accumulate contiguous heights into a tile for a single thread.
+    if (is_nonzero(tile_size_))
+    {
+        tile_.push_back(job);
+        if (tile_.size() >= tile_size_)
+            flush_tile();
+
+        return;
+    }
+
+    // Queue is full (backlog exceeds capacity), post the block individually.
+    if (!validation_queue_.push(job))
+    {
+        PARALLEL(validate_job, job);
+        return;
+    }
+
+    // Pairs with the validator fence, so either it observes this job or this
+    // observes its exit. Validators are added only here, on the strand.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (validators_.load() < threads_)
+    {
+        ++validators_;
+        PARALLEL(validate_queued);
+    }
+}
+
+// Validators yield the thread to other pool work (strand, batch) after each
+// quantum, and exit only upon an empty queue following their own release.
+void chaser_validate::validate_queued() NOEXCEPT
+{
+    validation_queue::job job{};
+    for (auto count = zero; count < validation_quantum; ++count)
+    {
+        if (!validation_queue_.pop(job))
+        {
+            --validators_;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!validation_queue_.pop(job))
+                return;
+
+            ++validators_;
+        }
+
+        validate_job(job);
+    }
+
+    PARALLEL(validate_queued);
+}
+
+// Tiles are taken by idle pool threads, so that balancing is by tile and the
+// store pages and caches of a height range remain warm on one thread.
+void chaser_validate::validate_tile(const jobs& tile) NOEXCEPT
+{
+    for (const auto& job: tile)
+        validate_job(job);
+}
+
+// private
+void chaser_validate::flush_tile() NOEXCEPT
 {
     BC_ASSERT(stranded());
-    PARALLEL(validate_block, link, bypass);
+    if (tile_.empty())
+        return;
+
+    PARALLEL(validate_tile, std::move(tile_));
+    tile_ = {};
+    tile_.reserve(tile_size_);
+}
+
+// private
+void chaser_validate::validate_job(const validation_queue::job& job) NOEXCEPT
+{
+    dequeued(job.height);
+    validate_block(job.link, job.bypass);
+}
+
+// Validators record the height being taken, which moves the prefetch window.
+// At most one prefetch scan is pending on the strand.
+void chaser_validate::dequeued(size_t height) NOEXCEPT
+{
+    if (!prefetch_enabled_)
+        return;
+
+    dequeued_.store(height);
+    if (!prefetching_.exchange(true))
+        POST(prefetch_blocks);
+}
+
+// Posted blocks are read ahead of validators, up to the prefetch distance in
+// heights above the most recently dequeued height. Blocks at or below that
+// height are being (or have been) read by validation and are skipped.
+void chaser_validate::prefetch_blocks() NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    prefetching_.store(false);
+    if (!prefetch_enabled_ || closed())
+        return;
+
+    // Nothing is pending, so any remaining entry is stale (e.g. recovery).
+    if (is_zero(validate_backlog_.load()))
+    {
+        prefetches_.clear();
+        clear_prefetched();
+        return;
+    }
+
+    const auto base = dequeued_.load();
+    const auto top = ceilinged_add(base, prefetch_distance_);
+    while (!prefetches_.empty())
+    {
+        const auto& job = prefetches_.front();
+        if (job.height > top)
+            break;
+
+        if (job.height > base)
+        {
+            {
+                std::unique_lock lock(prefetch_mutex_);
+                prefetched_.emplace(job.link.value, nullptr);
+            }
+
+            boost::asio::post(prefetch_threadpool_.service(),
+                BIND(prefetch_block, job.link));
+        }
+
+        prefetches_.pop_front();
+    }
+}
+
+// Deserialize the block on a prefetch thread (into its arena) and fault in its
+// prevout records, then hand the block to validation. Validation may have
+// already taken the entry, in which case the block is dropped.
+void chaser_validate::prefetch_block(const header_link& link) NOEXCEPT
+{
+    const auto block = closed() ? chain::block::cptr{} : get_block(link);
+    if (!block)
+        return;
+
+    touch_prevouts(*block);
+
+    std::unique_lock lock(prefetch_mutex_);
+    const auto it = prefetched_.find(link.value);
+    if (it != prefetched_.end())
+        it->second = block;
+}
+
+// Read (and drop) the output of each spent point, which faults in the output
+// and point records for population by validation. The block itself is not
+// populated, so no heap objects are attached to the (arena) block.
+void chaser_validate::touch_prevouts(const chain::block& block) NOEXCEPT
+{
+    const auto& query = archive();
+    const auto& txs = *block.transactions_ptr();
+    if (txs.size() < two)
+        return;
+
+    std::for_each(std::next(txs.begin()), txs.end(),
+        [&](const auto& tx) NOEXCEPT
+    {
+        for (const auto& input: *tx->inputs_ptr())
+        {
+            if (closed())
+                return;
+
+            query.get_output(input->point());
+        }
+    });
+}
+
+// Take the prefetched block, or read it when not (yet) prefetched. Taking the
+// entry abandons a prefetch that is in progress.
+chain::block::cptr chaser_validate::take_block(
+    const header_link& link) NOEXCEPT
+{
+    if (prefetch_enabled_)
+    {
+        chain::block::cptr block{};
+        {
+            std::unique_lock lock(prefetch_mutex_);
+            const auto it = prefetched_.find(link.value);
+            if (it != prefetched_.end())
+            {
+                block = std::move(it->second);
+                prefetched_.erase(it);
+            }
+        }
+
+        if (block)
+            return block;
+    }
+
+    return get_block(link);
+}
+
+void chaser_validate::clear_prefetched() NOEXCEPT
+{
+    std::unique_lock lock(prefetch_mutex_);
+    prefetched_.clear();
 }
 
 // May be either concurrent or stranded.
@@ -313,26 +559,54 @@ void chaser_validate::complete_block(const code& ec, const header_link& link,
     }
 }
 
+// Quiet suppresses the chase event (startup, or coalesced by the caller).
 void chaser_validate::notify_block(const code& ec, size_t height, 
-    const header_link& link, bool bypass, bool startup) NOEXCEPT
+    const header_link& link, bool bypass, bool quiet) NOEXCEPT
 {
     // Not stranded when complete_block is called from validate_block.
 
     if (ec)
     {
         // INVALID BLOCK (not a fault but discontinue)
-        if (!startup) notify(ec, chase::unvalid, link);
+        if (!quiet) notify(ec, chase::unvalid, link);
         fire(events::block_unconfirmable, height);
         LOGR("Invalid block [" << height << "] " << ec.message());
         return;
     }
 
     // VALID BLOCK
-    if (!startup) notify(ec, chase::valid, possible_wide_cast<height_t>(height));
+    if (!quiet) notify(ec, chase::valid, possible_wide_cast<height_t>(height));
     fire(events::block_validated, height);
     LOGV("Block validated: " << height << (bypass ? " (bypass)" : ""));
 }
 
+// Memory statistics
+// ----------------------------------------------------------------------------
+
+// private
+void chaser_validate::handle_memory_timer(const code& ec) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    if (closed() || !memory_timer_ || ec == network::error::operation_canceled)
+        return;
+
+    if (ec && ec != network::error::operation_timeout)
+    {
+        LOGF("Validation memory timer fault, " << ec.message());
+        return;
+    }
+
+    const auto memory = validation_memory_.get_statistics();
+    fire(events::arena_bytes, memory.bytes);
+    fire(events::arena_chunks, memory.chunks);
+    fire(events::arena_padding, memory.padding);
+    fire(events::arena_fallbacks, validation_memory_.fallbacks());
+    fire(events::arena_peak, memory.peak);
+    fire(events::capture_peak, capture_peak_.load());
+    fire(events::capture_releases, capture_releases_.load());
+    memory_timer_->start(BIND(handle_memory_timer, _1));
+}
+
 // Overrides due to independent priority thread pool
 // ----------------------------------------------------------------------------
 
@@ -341,18 +615,36 @@ void chaser_validate::stopping(const code& ec) NOEXCEPT
     // Stop long-running batch validations.
     stopping_.store(true);
 
+    // Cancel the timer before its wait can hold the threadpool join.
+    POST(do_stopping, ec);
+
     // Stop threadpool keep-alive, all work must self-terminate to affect join.
+    prefetch_threadpool_.stop();
     validation_threadpool_.stop();
     chaser::stopping(ec);
 }
 
 void chaser_validate::stop() NOEXCEPT
 {
-    if (!validation_threadpool_.join())
+    if (!prefetch_threadpool_.join() || !validation_threadpool_.join())
     {
         BC_ASSERT_MSG(false, "failed to join threadpool");
         std::abort();
     }
+
+    // Release prefetched blocks to their arenas.
+    clear_prefetched();
+}
+
+// private
+void chaser_validate::do_stopping(const code&) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    if (memory_timer_)
+    {
+        memory_timer_->stop();
+        memory_timer_.reset();
+    }
 }
 
 network::asio::strand& chaser_validate::strand() NOEXCEPT
@@ -20,6 +20,8 @@
 
 #include <atomic>
 #include <algorithm>
+#include <array>
+#include <functional>
 #include <thread>
 #include <bitcoin/node/define.hpp>
 
@@ -38,18 +40,56 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 // ----------------------------------------------------------------------------
 // protected
 
+// Batch tables retained from a prior run (e.g. unclean stop) are drained on
+// the validation pool, so that start does not wait on verification. The
+// drain is claimed until complete, so captures are parked and validation is
+// deferred until completion (bump).
 code chaser_validate::start_batch() NOEXCEPT
 {
     if (!batch_enabled_)
         return {};
 
     const auto& query = archive();
-    if (is_zero(query.prevalid_records()) &&
-        is_zero(query.ecdsa_records()) &&
-        is_zero(query.schnorr_records()))
+    const auto records =
+        query.prevalid_records() +
+        query.ecdsa_records() +
+        query.schnorr_records();
+
+    if (is_zero(records))
         return {};
 
-    return do_process_batch(true);
+    resuming_.store(true);
+    draining_.store(true);
+    fire(events::batch_resuming, records);
+    LOGN("Batch resuming (" << records << ") records.");
+    PARALLEL(do_resume_batch);
+    return {};
+}
+
+void chaser_validate::do_resume_batch() NOEXCEPT
+{
+    const auto start = network::logger::now();
+    const auto ec = do_process_batch(true);
+    draining_.store(false);
+    resuming_.store(false);
+
+    if (ec == network::error::operation_canceled)
+        return;
+
+    if (ec)
+    {
+        fault(ec);
+        return;
+    }
+
+    const auto elapsed = network::logger::now() - start;
+    fire(events::resume_secs, duration_cast<seconds>(elapsed).count());
+    LOGN("Batch resumed in " << duration_cast<seconds>(elapsed).count()
+        << " secs.");
+
+    // Startup drain does not notify valid blocks, so bump all chasers.
+    commit_parked();
+    notify(error::success, chase::bump, height_t{});
 }
 
 void chaser_validate::process_batch(bool residual) NOEXCEPT
@@ -83,6 +123,7 @@ void chaser_validate::process_batch(bool residual) NOEXCEPT
     if (!is_mature(residual))
     {
         draining_.store(false);
+        commit_parked();
         return;
     }
 
@@ -101,60 +142,79 @@ void chaser_validate::process_batch(bool residual) NOEXCEPT
 
     // Log outside of drain claim, and only when batch executes (non-verbose).
     log_captures();
+
+    // Commit captures parked during the drain, draining again when recent.
+    commit_parked();
+    if (is_residual())
+        process_batch(true);
 }
 
-// Guarded by the drain claim (or single-threaded at startup).
+// Guarded by the drain claim (including the startup drain).
 code chaser_validate::do_process_batch(bool startup) NOEXCEPT
 {
     auto& query = archive();
     auto prevalids = query.get_prevalids();
 
-    const auto ecdsa = query.ecdsa_records();
-    if (is_nonzero(ecdsa))
+    // The ecdsa and schnorr tables are independent, verified concurrently.
+    // Results are then applied in table order.
+    verification ecdsa{ query.ecdsa_records() };
+    verification schnorr{ query.schnorr_records() };
+    verify_tables(ecdsa, schnorr);
+
+    if (is_nonzero(ecdsa.records))
     {
-        header_links invalids{};
-        const auto start = network::logger::now();
-        if (!query.verify_ecdsa_signatures(stopping_, invalids))
+        if (!ecdsa.completed)
         {
-            LOGN("Batch verify ecdsa canceled (" << ecdsa << ").");
+            LOGN("Batch verify ecdsa canceled (" << ecdsa.records << ").");
             return network::error::operation_canceled;
         }
-        const auto elapsed = network::logger::now() - start;
-        fire(events::ecdsa_secs, duration_cast<seconds>(elapsed).count());
+
+        fire(events::ecdsa_secs,
+            duration_cast<seconds>(ecdsa.elapsed).count());
 
         if (!startup)
         {
-            LOGN(log_rate("Verify ecdsa.....", ecdsa,
-                duration_cast<milliseconds>(elapsed).count()));
+            LOGN(log_rate("Verify ecdsa.....", ecdsa.records,
+                ecdsa.elapsed.count()));
         }
 
-        if (!mark_invalids(prevalids, invalids, startup))
+        if (!mark_invalids(prevalids, ecdsa.invalids, startup))
             return error::batch1;
     }
 
-    const auto schnorr = query.schnorr_records();
-    if (is_nonzero(schnorr))
+    if (is_nonzero(schnorr.records))
     {
-        header_links invalids{};
-        const auto start = network::logger::now();
-        if (!query.verify_schnorr_signatures(stopping_, invalids))
+        if (!schnorr.completed)
         {
-            LOGN("Batch verify schnorr canceled (" << schnorr << ").");
+            LOGN("Batch verify schnorr canceled (" << schnorr.records << ").");
             return network::error::operation_canceled;
         }
-        const auto elapsed = network::logger::now() - start;
-        fire(events::schnorr_secs, duration_cast<seconds>(elapsed).count());
+
+        fire(events::schnorr_secs,
+            duration_cast<seconds>(schnorr.elapsed).count());
 
         if (!startup)
         {
-            LOGN(log_rate("Verify schnorr...", schnorr,
-                duration_cast<milliseconds>(elapsed).count()));
+            LOGN(log_rate("Verify schnorr...", schnorr.records,
+                schnorr.elapsed.count()));
         }
 
-        if (!mark_invalids(prevalids, invalids, startup))
+        if (!mark_invalids(prevalids, schnorr.invalids, startup))
             return error::batch2;
     }
 
+    // Partitions are concurrent, so the drain duration is the greater. Only
+    // mature drains adapt the target, as residual drains are short by nature
+    // and would otherwise spiral the target down to the minimum.
+    const auto mature = (ecdsa.records >= adapted_target_.get()) ||
+        (schnorr.records >= adapted_target_.get());
+
+    if (!startup && mature)
+    {
+        adapt_target(ecdsa.records + schnorr.records,
+            std::max(ecdsa.elapsed, schnorr.elapsed).count());
+    }
+
     if (!mark_valids(prevalids, startup))
         return error::batch3;
 
@@ -168,37 +228,60 @@ code chaser_validate::do_process_batch(bool startup) NOEXCEPT
 bool chaser_validate::mark_invalids(header_links& prevalids,
     const header_links& invalids, bool startup) NOEXCEPT
 {
+    // Invalids is almost always empty.
+    if (invalids.empty())
+        return true;
+
+    // Distinct and sorted, for logarithmic exclusion.
+    auto sorted = invalids;
+    std::ranges::sort(sorted, {}, &header_link::value);
+    const auto duplicates = std::ranges::unique(sorted, {},
+        &header_link::value);
+    sorted.erase(duplicates.begin(), duplicates.end());
+
     auto& query = archive();
-    for (const auto& link: invalids)
+    std::atomic_bool fault{};
+    constexpr auto parallel = poolstl::execution::par;
+
+    std::for_each(parallel, sorted.cbegin(), sorted.cend(),
+        [&](auto link) NOEXCEPT
     {
         size_t height{};
         if (!query.get_height(height, link) ||
             !query.set_block_unconfirmable(link))
-            return false;
+        {
+            fault.store(true);
+            return;
+        }
 
         const auto ec = system::error::invalid_signature;
         notify_block(ec, height, link, false, startup);
-    }
+    });
+
+    if (fault.load())
+        return false;
 
-    // Exclude invalid links from marking, invalids is almost always empty.
-    if (!invalids.empty())
+    // Exclude invalid links from marking.
+    std::for_each(parallel, prevalids.begin(), prevalids.end(),
+        [&](header_link& link) NOEXCEPT
     {
-        std::ranges::replace_if(prevalids, [&](const header_link& link) NOEXCEPT
-        {
-            return contains(invalids, link);
-        }, header_link::terminal);
-    }
+        if (std::ranges::binary_search(sorted, link.value, {},
+            &header_link::value))
+            link = header_link::terminal;
+    });
 
     return true;
 }
 
 // Set all prevalid blocks that aren't invalid to valid.
 // May be ancestors of invalid, in which case they are also unconfirmable.
+// Valid notifications are coalesced into a single event for the batch.
 bool chaser_validate::mark_valids(header_links& prevalids,
     bool startup) NOEXCEPT
 {
     auto& query = archive();
     std::atomic_bool fault{};
+    atomic_counter valids{};
     constexpr auto parallel = poolstl::execution::par;
 
     // Allow valids to drain when closed.
@@ -216,9 +299,13 @@ bool chaser_validate::mark_valids(header_links& prevalids,
             return;
         }
 
-        notify_block(system::error::success, height, link, false, startup);
+        notify_block(system::error::success, height, link, false, true);
+        ++valids;
     });
 
+    if (!startup && is_nonzero(valids.load()))
+        notify(error::success, chase::valids, count_t{ valids.load() });
+
     return !fault.load();
 }
 
@@ -226,6 +313,61 @@ bool chaser_validate::mark_valids(header_links& prevalids,
 // ----------------------------------------------------------------------------
 // private
 
+// Verify each non-empty table on its own thread.
+void chaser_validate::verify_tables(verification& ecdsa,
+    verification& schnorr) NOEXCEPT
+{
+    auto& query = archive();
+    constexpr auto parallel = poolstl::execution::par;
+    const auto verify = [](verification& table, auto&& verifier) NOEXCEPT
+    {
+        if (is_zero(table.records))
+            return;
+
+        const auto start = network::logger::now();
+        table.completed = verifier(table.invalids);
+        table.elapsed = duration_cast<milliseconds>(
+            network::logger::now() - start);
+    };
+
+    const std::array<std::function<void()>, 2> tables
+    {
+        [&]() NOEXCEPT
+        {
+            verify(ecdsa, [&](header_links& invalids) NOEXCEPT
+            {
+                return query.verify_ecdsa_signatures(stopping_, invalids);
+            });
+        },
+        [&]() NOEXCEPT
+        {
+            verify(schnorr, [&](header_links& invalids) NOEXCEPT
+            {
+                return query.verify_schnorr_signatures(stopping_, invalids);
+            });
+        }
+    };
+
+    std::for_each(parallel, tables.begin(), tables.end(),
+        [](const auto& table) NOEXCEPT { table(); });
+}
+
+// Adapt the batch target to the latency bound (see batch_target). Latency is
+// quartered once the candidate chain is current (near the tip).
+void chaser_validate::adapt_target(size_t signatures,
+    size_t milliseconds) NOEXCEPT
+{
+    const auto current = is_current_chain(false);
+    const auto latency = current ? batch_latency_ / 4u : batch_latency_;
+    const auto prior = adapted_target_.get();
+    if (adapted_target_.adapt(signatures, milliseconds, latency))
+    {
+        const auto rate = (signatures * 1000u) / greater(milliseconds, one);
+        LOGN("Batch target (" << prior << " -> " << adapted_target_.get()
+            << ") at " << rate << " sps" << (current ? " (current)." : "."));
+    }
+}
+
 bool chaser_validate::is_residual() NOEXCEPT
 {
     // Verify residuals when recent or window is fully archived.
@@ -246,8 +388,8 @@ bool chaser_validate::is_mature(bool residual) NOEXCEPT
 
     // Verify residuals whenever, and non-residuals when mature.
     return residual ||
-        (ecdsa >= batch_target_) ||
-        (schnorr >= batch_target_);
+        (ecdsa >= adapted_target_.get()) ||
+        (schnorr >= adapted_target_.get());
 }
 
 std::string chaser_validate::log_rate(const std::string& name,
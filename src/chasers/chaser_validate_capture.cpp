@@ -18,6 +18,9 @@
  */
 #include <bitcoin/node/chasers/chaser_validate.hpp>
 
+#include <mutex>
+#include <utility>
+#include <vector>
 #include <bitcoin/node/define.hpp>
 
 namespace libbitcoin {
@@ -32,6 +35,15 @@ using namespace std::placeholders;
 
 BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 
+// Retained capacity of an accumulator, in bytes.
+template <typename Accumulator>
+static size_t capacity_bytes(const Accumulator& accumulator) NOEXCEPT
+{
+    const auto& rows = accumulator.rows();
+    using row = typename std::remove_cvref_t<decltype(rows)>::value_type;
+    return rows.capacity() * sizeof(row);
+}
+
 // Capture handlers.
 // ----------------------------------------------------------------------------
 // private
@@ -43,8 +55,10 @@ void chaser_validate::do_log(const script& ) NOEXCEPT
     ////    << missed.to_string(flags::all_rules));
 }
 
-void chaser_validate::do_fire(missed miss, size_t count) NOEXCEPT
+void chaser_validate::do_fire(missed miss, size_t count,
+    size_t height) NOEXCEPT
 {
+    capture_policy_.missed(height, count);
     switch (miss)
     {
         case missed::ecdsa:
@@ -64,9 +78,11 @@ void chaser_validate::do_fire(missed miss, size_t count) NOEXCEPT
 // ----------------------------------------------------------------------------
 // private
 
-signatures chaser_validate::get_capture(const header_link& link) NOEXCEPT
+signatures chaser_validate::get_capture(const header_link& link,
+    size_t height) NOEXCEPT
 {
-    if (!batch_enabled_ || link.is_terminal() || is_current_header(link))
+    if (!batch_enabled_ || link.is_terminal() || is_current_header(link) ||
+        skip_capture(height))
         return { false };
 
     // The capture populates this thread's accumulators (commit_capture consumes).
@@ -74,22 +90,48 @@ signatures chaser_validate::get_capture(const header_link& link) NOEXCEPT
     {
         .enabled = true,
         .log = BIND_THIS(do_log, _1),
-        .fire = BIND_THIS(do_fire, _1, _2)
+        .fire = [this, height](missed miss, size_t count) NOEXCEPT
+        {
+            do_fire(miss, count, height);
+        }
     };
 }
 
+// Capture is skipped for a height range when the miss ratio of the prior
+// range reached the configured percentage (see capture_policy).
+bool chaser_validate::skip_capture(size_t height) NOEXCEPT
+{
+    capture_policy::report report{};
+    const auto skip = capture_policy_.skip(height, report);
+
+    if (report.changed)
+    {
+        LOGN("Capture " << (skip ? "skipped" : "resumed") << " at ["
+            << height << "] " << log_ratio("missed", report.missed,
+                report.total));
+    }
+
+    return skip;
+}
+
 // Commit this thread's captured signatures as the block's batch rows. All
 // batch table state is written inside the commit epoch (turnstile). When
-// diverted by a drain, or upon store decline, the rows are verified in
-// place, equivalent to the inline evaluation their capture fabricated
-// (batched is cleared so the block completes by the non-batched path).
+// diverted by a drain the rows are parked (back buffer) for commit upon its
+// completion. When the back buffer is full, or upon store decline, the rows
+// are verified in place, equivalent to the inline evaluation their capture
+// fabricated (batched is cleared so the block completes by the non-batched
+// path).
 code chaser_validate::commit_capture(bool& batched,
-    const header_link& link) NOEXCEPT
+    const header_link& link, size_t height) NOEXCEPT
 {
     code ec{};
     auto committed = false;
     auto& ecdsa = signatures::ecdsa_rows();
     auto& schnorr = signatures::schnorr_rows();
+    const auto ecdsas = ecdsa.singles();
+    const auto multisigs = ecdsa.multisig_keys();
+    const auto thresholds = schnorr.thresholds();
+    const auto singles = schnorr.rows().size() - thresholds;
 
     if (enter_capture())
     {
@@ -104,21 +146,24 @@ code chaser_validate::commit_capture(bool& batched,
         if (!committed)
             fault(error::batch5);
     }
-
-    const auto thresholds = schnorr.thresholds();
-    const auto singles = schnorr.rows().size() - thresholds;
+    else
+    {
+        committed = park_capture(link);
+    }
 
     if (committed)
     {
-        counters_.ecdsa_ += ecdsa.singles();
-        counters_.multisig_ += ecdsa.multisig_keys();
+        capture_policy_.captured(height,
+            ecdsas + multisigs + singles + thresholds);
+        counters_.ecdsa_ += ecdsas;
+        counters_.multisig_ += multisigs;
         counters_.schnorr_ += singles;
         counters_.threshold_ += thresholds;
     }
     else
     {
-        counters_.missed_ecdsa_ += ecdsa.singles();
-        counters_.missed_multisig_ += ecdsa.multisig_keys();
+        counters_.missed_ecdsa_ += ecdsas;
+        counters_.missed_multisig_ += multisigs;
         counters_.missed_schnorr_ += singles;
         counters_.missed_threshold_ += thresholds;
 
@@ -130,6 +175,7 @@ code chaser_validate::commit_capture(bool& batched,
 
     ecdsa.clear();
     schnorr.clear();
+    limit_capture();
     return ec;
 }
 
@@ -138,16 +184,114 @@ void chaser_validate::clear_capture() NOEXCEPT
 {
     signatures::ecdsa_rows().clear();
     signatures::schnorr_rows().clear();
+    limit_capture();
+}
+
+// Accumulators retain capacity between blocks, which after a large block
+// may be excessive across many threads. Capacity beyond the per-thread
+// limit is released, and the peak (any thread) is recorded.
+void chaser_validate::limit_capture() NOEXCEPT
+{
+    auto& ecdsa = signatures::ecdsa_rows();
+    auto& schnorr = signatures::schnorr_rows();
+    const auto bytes = capacity_bytes(ecdsa) + capacity_bytes(schnorr);
+
+    auto peak = capture_peak_.load(std::memory_order_relaxed);
+    while ((bytes > peak) && !capture_peak_.compare_exchange_weak(peak, bytes,
+        std::memory_order_relaxed));
+
+    if (is_nonzero(batch_thread_bytes_) && (bytes > batch_thread_bytes_))
+    {
+        ecdsa = ecdsa_rows{};
+        schnorr = schnorr_rows{};
+        ++capture_releases_;
+    }
 }
 
-// Release all threads' accumulator capacity (batching subsided). Safe on the
-// strand with an empty backlog: accumulators are populated only within
-// validate_block, and the strand is the sole poster of validations.
+// Move this thread's captured signatures to the back buffer, bounded by the
+// batch target. The drain may complete before the capture is parked, in
+// which case it is committed here.
+bool chaser_validate::park_capture(const header_link& link) NOEXCEPT
+{
+    auto& ecdsa = signatures::ecdsa_rows();
+    auto& schnorr = signatures::schnorr_rows();
+    const auto rows = ecdsa.rows().size() + schnorr.rows().size();
+
+    {
+        std::unique_lock lock{ parked_mutex_ };
+        if (parked_rows_ + rows > batch_target_)
+            return false;
+
+        parked_rows_ += rows;
+        parked_.push_back({ link, std::move(ecdsa), std::move(schnorr) });
+    }
+
+    if (!draining_.load())
+        commit_parked();
+
+    return true;
+}
+
+// Commit parked captures outside of a drain. A capture diverted by a new
+// drain is reparked, and is committed upon that drain's completion.
+void chaser_validate::commit_parked() NOEXCEPT
+{
+    auto& query = archive();
+    while (!draining_.load() && !closed())
+    {
+        std::vector<parked> captures{};
+        {
+            std::unique_lock lock{ parked_mutex_ };
+            std::swap(captures, parked_);
+            parked_rows_ = zero;
+        }
+
+        if (captures.empty())
+            return;
+
+        for (auto& capture: captures)
+        {
+            if (!enter_capture())
+            {
+                repark(std::move(capture));
+                continue;
+            }
+
+            const auto committed =
+                query.set_signatures(capture.ecdsa, capture.link) &&
+                query.set_signatures(capture.schnorr, capture.link) &&
+                query.set_prevalid(capture.link);
+            exit_capture();
+
+            // Store decline (e.g. disk full), the block remains unvalidated.
+            if (!committed)
+            {
+                fault(error::batch5);
+                return;
+            }
+        }
+    }
+}
+
+void chaser_validate::repark(parked&& capture) NOEXCEPT
+{
+    std::unique_lock lock{ parked_mutex_ };
+    parked_rows_ += capture.ecdsa.rows().size() + capture.schnorr.rows().size();
+    parked_.push_back(std::move(capture));
+}
+
+// Release all threads' accumulator and arena capacity (batching subsided).
+// Safe on the strand with an empty backlog: accumulators and arenas are used
+// only within validate_block, and the strand is the sole poster of
+// validations.
 void chaser_validate::do_purge_capture() NOEXCEPT
 {
     BC_ASSERT(stranded());
     if (is_zero(validate_backlog_.load()))
+    {
         signatures::purge();
+        validation_memory_.trim();
+    }
 }
 
 std::string chaser_validate::log_ratio(const std::string& name,
@@ -171,6 +315,22 @@ void chaser_validate::log_captures() const NOEXCEPT
         counters_.schnorr_   + counters_.missed_schnorr_));
     LOGN(log_ratio("Capture threshold", counters_.threshold_,
         counters_.threshold_ + counters_.missed_threshold_));
+
+    // Arena tuning: slack is unused chunk bytes, overflow is extra chunks.
+    const auto memory = validation_memory_.get_statistics();
+    LOGN(log_ratio("Arena slack......", memory.slack,
+        memory.slack + memory.bytes));
+    LOGN(log_ratio("Arena overflow...", memory.chunks - memory.allocations,
+        memory.allocations));
+
+    // Largest retained capture capacity of any thread.
+    LOGN("Capture peak..... " << capture_peak_.load() << " bytes ("
+        << capture_releases_.load() << " releases).");
+
+    // Fallbacks are blocks allocated outside of an arena (slots exhausted).
+    const auto fallbacks = validation_memory_.fallbacks();
+    LOGN(log_ratio("Arena fallback...", fallbacks,
+        memory.allocations + fallbacks));
 }
 
 BC_POP_WARNING()
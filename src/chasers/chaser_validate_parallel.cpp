@@ -18,6 +18,7 @@
  */
 #include <bitcoin/node/chasers/chaser_validate.hpp>
 
+#include <memory>
 #include <shared_mutex>
 #include <bitcoin/node/define.hpp>
 
@@ -26,6 +27,9 @@ namespace node {
 
 using namespace system;
 using namespace database;
+using namespace std::chrono;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 
 // Parallel execution path (concurrent by block).
 // ----------------------------------------------------------------------------
@@ -41,37 +45,94 @@ void chaser_validate::validate_block(const header_link& link,
     bool batched{}, capturing{};
     auto& query = archive();
 
-    // TODO: implement allocator parameter resulting in full allocation to
-    // shared_ptr<block>, to optimize deallocate (12% of milestone/filter).
-    const auto block = query.get_block(link, node_witness_);
-
-    if (!block)
+    // Scoped so that the block (arena) is released before backlog decrement.
     {
-        ec = error::validate2;
+        const auto block = take_block(link);
+
+        if (!block)
+        {
+            ec = error::validate2;
+        }
+        else if (!query.get_context(ctx, link))
+        {
+            ec = error::validate3;
+        }
+        else if ((ec = populate(bypass, *block, ctx)))
+        {
+            if (!query.set_block_unconfirmable(link))
+                ec = error::validate4;
+        }
+        else if ((ec = validate(batched, capturing, bypass, *block, link,
+            ctx)))
+        {
+            if (!query.set_block_unconfirmable(link))
+                ec = error::validate5;
+        }
     }
-    else if (!query.get_context(ctx, link))
+
+    --validate_backlog_;
+    complete_block(ec, link, ctx.height, bypass, batched, capturing);
+}
+
+// helpers
+// ----------------------------------------------------------------------------
+
+// Deserialize the full block (txs, scripts, witnesses) into this thread's
+// arena, so that deallocation is a single release when the pointer drops.
+// The pointer may be dropped by any thread, arena release is thread safe.
+chain::block::cptr chaser_validate::get_block(const header_link& link) NOEXCEPT
+{
+    const auto& query = archive();
+    const auto memory = validation_memory_.get_arena();
+
+    // Arena disabled or threads exceeded, read block from store.
+    if (memory == default_arena::get())
+        return query.get_block(link, node_witness_);
+
+    const auto data = query.get_wire_block(link, node_witness_);
+    if (data.empty())
+        return {};
+
+    void* begin{};
+    chain::block* block{};
+    stream::in::fast source{ data };
+    read::bytes::fast reader{ source, memory };
+
+    try
     {
-        ec = error::validate3;
+        begin = memory->start(data.size());
+        block = reader.get_allocator().new_object<chain::block>(reader,
+            node_witness_);
     }
-    else if ((ec = populate(bypass, *block, ctx)))
+    catch (const allocation_exception&)
     {
-        if (!query.set_block_unconfirmable(link))
-            ec = error::validate4;
+        // Arena exhausted (chunk allocation failed), read block from store.
+        // The partial allocation is discarded, not detached (or sampled).
+        memory->release(begin);
+        return query.get_block(link, node_witness_);
     }
-    else if ((ec = validate(batched, capturing, bypass, *block, link,
-        ctx)))
+
+    // Total allocation is not tracked here.
+    memory->detach();
+
+    if (is_null(block) || !reader)
     {
-        if (!query.set_block_unconfirmable(link))
-            ec = error::validate5;
+        if (!is_null(block))
+            std::destroy_at(block);
+
+        memory->release(begin);
+        return {};
     }
 
-    --validate_backlog_;
-    complete_block(ec, link, ctx.height, bypass, batched, capturing);
+    // The block is destructed to drop heap objects attached by population
+    // and validation (prevouts, caches), its own memory is owned by the arena.
+    return { block, [memory, begin](auto pointer) NOEXCEPT
+    {
+        std::destroy_at(pointer);
+        memory->release(begin);
+    }};
 }
 
-// helpers
-// ----------------------------------------------------------------------------
-
 code chaser_validate::populate(bool bypass, const chain::block& block,
     const chain::context& ctx) NOEXCEPT
 {
@@ -115,7 +176,7 @@ code chaser_validate::validate(bool& batched, bool& capturing, bool bypass,
             return ec;
 
         // Initialize signature capture (appends to this thread's accumulators).
-        const auto capture = get_capture(link);
+        const auto capture = get_capture(link, ctx.height);
         capturing = capture.enabled;
 
         ec = block.connect(ctx, capture);
@@ -129,7 +190,7 @@ code chaser_validate::validate(bool& batched, bool& capturing, bool bypass,
         if (capturing)
         {
             if (!ec && batched)
-                ec = commit_capture(batched, link);
+                ec = commit_capture(batched, link, ctx.height);
             else
                 clear_capture();
         }
@@ -137,7 +198,9 @@ code chaser_validate::validate(bool& batched, bool& capturing, bool bypass,
         if (ec)
             return ec;
 
-        // Prevouts optimize confirmation.
+        // Prevouts optimize confirmation. These writes are not deferred to a
+        // window flush, as records are derived from the block, which is
+        // released (arena) upon validation.
         if (!query.set_prevouts(link, block))
             return error::validate7;
     }
@@ -145,9 +208,15 @@ code chaser_validate::validate(bool& batched, bool& capturing, bool bypass,
     if (!query.set_filter_body(link, block))
         return error::validate8;
 
-    if ((ctx.height >= silent_start_height_) &&
-        !query.set_silent(link, block))
-        return error::validate9;
+    // Silent payment scanning is reported per block (timespan).
+    if (ctx.height >= silent_start_height_)
+    {
+        const auto start = network::logger::now();
+        if (!query.set_silent(link, block))
+            return error::validate9;
+
+        span<seconds>(events::silent_secs, start);
+    }
 
     // Defer block state change when batched.
     // Valid must be set after set_prevouts, set_filter_body, and set_silent.
@@ -157,5 +226,7 @@ code chaser_validate::validate(bool& batched, bool& capturing, bool bypass,
     return error::success;
 }
 
+BC_POP_WARNING()
+
 } // namespace node
 } // namespace libbitcoin
@@ -174,9 +174,9 @@ void full_node::organize(const system::chain::block::cptr& block,
     chaser_block_.organize(block, std::move(handler));
 }
 
-void full_node::get_hashes(map_handler&& handler) NOEXCEPT
+void full_node::get_hashes(object_key channel, map_handler&& handler) NOEXCEPT
 {
-    chaser_check_.get_hashes(std::move(handler));
+    chaser_check_.get_hashes(channel, std::move(handler));
 }
 
 void full_node::put_hashes(const map_ptr& map,
@@ -185,6 +185,16 @@ void full_node::put_hashes(const map_ptr& map,
     chaser_check_.put_hashes(map, std::move(handler));
 }
 
+bool full_node::claim_block(const database::header_link& link) NOEXCEPT
+{
+    return chaser_check_.claim_block(link);
+}
+
+void full_node::release_block(const database::header_link& link) NOEXCEPT
+{
+    chaser_check_.release_block(link);
+}
+
 // Events.
 // ----------------------------------------------------------------------------
 
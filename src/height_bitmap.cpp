@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/node/height_bitmap.hpp>
+
+#include <bit>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// Mask of the low (bits) bits of a word, bits less than word size.
+static constexpr uint64_t low_mask(size_t bits) NOEXCEPT
+{
+    return sub1(uint64_t{ 1 } << bits);
+}
+
+height_bitmap::height_bitmap() NOEXCEPT
+{
+}
+
+void height_bitmap::reset(size_t base) NOEXCEPT
+{
+    origin_ = base_ = base;
+    words_.clear();
+}
+
+void height_bitmap::set(size_t height) NOEXCEPT
+{
+    if (height <= base_)
+        return;
+
+    const auto index = sub1(height - origin_);
+    const auto word = index / word_bits;
+    if (word >= words_.size())
+        words_.resize(add1(word));
+
+    words_[word] |= (uint64_t{ 1 } << (index % word_bits));
+}
+
+bool height_bitmap::get(size_t height) const NOEXCEPT
+{
+    if (height <= base_)
+        return true;
+
+    const auto index = sub1(height - origin_);
+    const auto word = index / word_bits;
+    if (word >= words_.size())
+        return false;
+
+    return to_bool(words_[word] & (uint64_t{ 1 } << (index % word_bits)));
+}
+
+void height_bitmap::clear_above(size_t height) NOEXCEPT
+{
+    if (height <= base_)
+    {
+        reset(height);
+        return;
+    }
+
+    const auto index = sub1(height - origin_);
+    const auto word = index / word_bits;
+    if (word >= words_.size())
+        return;
+
+    words_.resize(add1(word));
+    const auto keep = add1(index % word_bits);
+    if (keep < word_bits)
+        words_.back() &= low_mask(keep);
+}
+
+// Heights at or below base within the first word are always set, so the
+// contiguous top is the count of trailing ones (ctz of the inverse).
+size_t height_bitmap::advance() NOEXCEPT
+{
+    while (!words_.empty())
+    {
+        const size_t ones = to_unsigned(std::countr_one(words_.front()));
+
+        if (ones < word_bits)
+        {
+            base_ = origin_ + ones;
+            break;
+        }
+
+        words_.pop_front();
+        origin_ += word_bits;
+        base_ = origin_;
+    }
+
+    return base_;
+}
+
+size_t height_bitmap::base() const NOEXCEPT
+{
+    return base_;
+}
+
+size_t height_bitmap::missing(size_t top) const NOEXCEPT
+{
+    if (top <= base_)
+        return zero;
+
+    // Count set bits through top (including those at or below base).
+    const auto last = sub1(top - origin_);
+    size_t set{};
+    for (size_t word = 0; word < words_.size(); ++word)
+    {
+        const auto first = word * word_bits;
+        if (first > last)
+            break;
+
+        auto bits = words_[word];
+        if ((last - first) < sub1(word_bits))
+            bits &= low_mask(add1(last - first));
+
+        set += to_unsigned(std::popcount(bits));
+    }
+
+    // Bits at or below base are set, exclude them.
+    return (top - base_) - (set - (base_ - origin_));
+}
+
+BC_POP_WARNING()
+
+} // namespace node
+} // namespace libbitcoin
@@ -288,6 +288,12 @@ bool protocol_block_in_31800::handle_receive_block(const code& ec,
     auto& query = archive();
     const auto link = it->link;
     const auto height = it->context.height;
+
+    // Endgame duplicate already stored from another channel (first wins).
+    // Cheap pre-test, the claim below is atomic across channels.
+    if (endgame_ && query.is_associated(link))
+        return handle_duplicate(hash, height);
+
     const auto checked = is_under_checkpoint(height);
     const auto bypass = checked || query.is_milestone(link);
     if (node_pruned_ && bypass && block.is_segregated())
@@ -334,12 +340,20 @@ bool protocol_block_in_31800::handle_receive_block(const code& ec,
     // Commit block.txs.
     // ........................................................................
 
-    if (const auto code = query.set_code(block, link, checked, bypass, height))
+    // Endgame duplicate stored or being stored from another channel.
+    if (endgame_ && !claim_block(link))
+        return handle_duplicate(hash, height);
+
+    const auto stored = query.set_code(block, link, checked, bypass, height);
+    if (endgame_)
+        release_block(link);
+
+    if (stored)
     {
         LOGF("Failure storing block [" << encode_hash(hash) << ":" << height
-            << "] from [" << opposite() << "] " << code.message());
+            << "] from [" << opposite() << "] " << stored.message());
 
-        stop(fault(code));
+        stop(fault(stored));
         return false;
     }
 
@@ -363,6 +377,24 @@ bool protocol_block_in_31800::handle_receive_block(const code& ec,
     return true;
 }
 
+bool protocol_block_in_31800::handle_duplicate(const hash_digest& hash,
+    size_t height) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    LOGR("Duplicate block [" << encode_hash(hash) << ":" << height
+        << "] from [" << opposite() << "].");
+
+    map_->erase(map_->find(hash));
+    if (is_idle())
+    {
+        job_.reset();
+        get_hashes(BIND(handle_get_hashes, _1, _2, _3));
+    }
+
+    return true;
+}
+
 // Header is checked by organize, Check/Accept/Connect are called by validate.
 // While check could be called here, it's more optimal to defer to validate, as
 // requiring only identity here allows the use of the simplified block_view.
@@ -43,7 +43,8 @@ void protocol_peer::organize(const system::chain::block::cptr& block,
 
 void protocol_peer::get_hashes(map_handler&& handler) NOEXCEPT
 {
-    session_->get_hashes(std::move(handler));
+    // Work is sized by performance, reported under the same key.
+    session_->get_hashes(events_key(), std::move(handler));
 }
 
 void protocol_peer::put_hashes(const map_ptr& map,
@@ -52,6 +53,16 @@ void protocol_peer::put_hashes(const map_ptr& map,
     session_->put_hashes(map, std::move(handler));
 }
 
+bool protocol_peer::claim_block(const database::header_link& link) NOEXCEPT
+{
+    return session_->claim_block(link);
+}
+
+void protocol_peer::release_block(const database::header_link& link) NOEXCEPT
+{
+    session_->release_block(link);
+}
+
 // Methods.
 // ----------------------------------------------------------------------------
 
@@ -52,9 +52,9 @@ void session::organize(const block::cptr& block,
     node_.organize(block, std::move(handler));
 }
 
-void session::get_hashes(map_handler&& handler) NOEXCEPT
+void session::get_hashes(object_key channel, map_handler&& handler) NOEXCEPT
 {
-    node_.get_hashes(std::move(handler));
+    node_.get_hashes(channel, std::move(handler));
 }
 
 void session::put_hashes(const map_ptr& map,
@@ -63,6 +63,16 @@ void session::put_hashes(const map_ptr& map,
     node_.put_hashes(map, std::move(handler));
 }
 
+bool session::claim_block(const database::header_link& link) NOEXCEPT
+{
+    return node_.claim_block(link);
+}
+
+void session::release_block(const database::header_link& link) NOEXCEPT
+{
+    node_.release_block(link);
+}
+
 // Events.
 // ----------------------------------------------------------------------------
 
@@ -36,11 +36,20 @@ settings::settings() NOEXCEPT
     memory_priority{ true },
     thread_priority{ true },
     allow_overlapped{ true },
+    allocation_hugepages{ false },
+    allocation_recycle{ true },
     batch_signatures{ 0 },
+    batch_thread_bytes{ 0 },
+    batch_latency_seconds{ 0 },
+    batch_miss_percent{ 0 },
+    allocation_multiple{ 20 },
     minimum_fee_rate{ 0.0 },
     minimum_bump_rate{ 0.0 },
     allowed_deviation{ 1.5 },
     announcement_cache{ 42 },
+    prefetch_threads{ 0 },
+    prefetch_distance{ 64 },
+    validation_tile{ 0 },
     fee_estimate_horizon{ 0 },
     ////snapshot_bytes{ 200'000'000'000 },
     ////snapshot_valid{ 250'000 },
@@ -48,6 +57,7 @@ settings::settings() NOEXCEPT
     maximum_height{ 0 },
     silent_start_height{ 0xffffffff_u32 },
     maximum_concurrency{ 50'000 },
+    endgame_blocks{ 0 },
     sample_period_seconds{ 10 },
     currency_window_minutes{ 1440 },
     warn_dirty_background_ratio{ 90_u16 },
@@ -91,6 +101,16 @@ bool settings::batch_signatures_enabled() const NOEXCEPT
     return to_bool(batch_signatures);
 }
 
+bool settings::allocation_enabled() const NOEXCEPT
+{
+    return to_bool(allocation_multiple);
+}
+
+bool settings::prefetch_enabled() const NOEXCEPT
+{
+    return to_bool(prefetch_threads) && to_bool(prefetch_distance);
+}
+
 network::steady_clock::duration settings::sample_period() const NOEXCEPT
 {
     return network::seconds(sample_period_seconds);
@@ -0,0 +1,137 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/node/speed_index.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+speed_index::speed_index() NOEXCEPT
+{
+}
+
+void speed_index::set(object_key channel, double speed) NOEXCEPT
+{
+    const auto it = index_.find(channel);
+    if (it == index_.end())
+    {
+        index_.emplace(channel, order_.emplace(speed, channel));
+        add(speed);
+        return;
+    }
+
+    subtract(it->second->first);
+    order_.erase(it->second);
+    it->second = order_.emplace(speed, channel);
+    add(speed);
+}
+
+bool speed_index::erase(object_key channel) NOEXCEPT
+{
+    const auto it = index_.find(channel);
+    if (it == index_.end())
+        return false;
+
+    subtract(it->second->first);
+    order_.erase(it->second);
+    index_.erase(it);
+
+    // Reset sums when empty, so that rounding error does not accumulate.
+    if (order_.empty())
+        sum_ = squares_ = 0.0;
+
+    return true;
+}
+
+bool speed_index::contains(object_key channel) const NOEXCEPT
+{
+    return index_.find(channel) != index_.end();
+}
+
+double speed_index::speed(object_key channel) const NOEXCEPT
+{
+    const auto it = index_.find(channel);
+    return it == index_.end() ? 0.0 : it->second->first;
+}
+
+bool speed_index::slowest(object_key& out) const NOEXCEPT
+{
+    if (order_.empty())
+        return false;
+
+    out = order_.begin()->second;
+    return true;
+}
+
+size_t speed_index::size() const NOEXCEPT
+{
+    return order_.size();
+}
+
+bool speed_index::empty() const NOEXCEPT
+{
+    return order_.empty();
+}
+
+double speed_index::sum() const NOEXCEPT
+{
+    return sum_;
+}
+
+double speed_index::mean() const NOEXCEPT
+{
+    return order_.empty() ? 0.0 : sum_ / order_.size();
+}
+
+// Running sums may cancel to a small negative, which is taken as zero.
+double speed_index::variance() const NOEXCEPT
+{
+    const auto count = order_.size();
+    if (count < two)
+        return 0.0;
+
+    const auto variance = (squares_ - (sum_ * sum_) / count) / sub1(count);
+    return std::max(variance, 0.0);
+}
+
+// protected
+
+void speed_index::add(double speed) NOEXCEPT
+{
+    sum_ += speed;
+    squares_ += speed * speed;
+}
+
+void speed_index::subtract(double speed) NOEXCEPT
+{
+    sum_ -= speed;
+    squares_ -= speed * speed;
+}
+
+BC_POP_WARNING()
+
+} // namespace node
+} // namespace libbitcoin
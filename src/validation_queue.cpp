@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/node/validation_queue.hpp>
+
+#include <atomic>
+#include <memory>
+#include <bitcoin/node/define.hpp>
+
+namespace libbitcoin {
+namespace node {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// Each cell sequence is its position when writable and position + 1 when
+// readable, so producers and consumers claim cells with a single cas.
+validation_queue::validation_queue(size_t capacity) NOEXCEPT
+  : mask_(sub1(to_size(capacity))),
+    cells_(std::make_unique<cell[]>(add1(mask_)))
+{
+    for (auto position = zero; position <= mask_; ++position)
+        cells_[position].sequence.store(position, std::memory_order_relaxed);
+}
+
+bool validation_queue::push(const job& value) NOEXCEPT
+{
+    auto position = tail_.load(std::memory_order_relaxed);
+    while (true)
+    {
+        auto& cell = cells_[position & mask_];
+        const auto sequence = cell.sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<ptrdiff_t>(sequence - position);
+
+        if (is_zero(difference))
+        {
+            if (tail_.compare_exchange_weak(position, add1(position),
+                std::memory_order_relaxed))
+            {
+                cell.value = value;
+                cell.sequence.store(add1(position), std::memory_order_release);
+                return true;
+            }
+        }
+        else if (is_negative(difference))
+        {
+            // The cell has not been read since the last wrap (full).
+            return false;
+        }
+        else
+        {
+            position = tail_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool validation_queue::pop(job& out) NOEXCEPT
+{
+    auto position = head_.load(std::memory_order_relaxed);
+    while (true)
+    {
+        auto& cell = cells_[position & mask_];
+        const auto sequence = cell.sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<ptrdiff_t>(sequence -
+            add1(position));
+
+        if (is_zero(difference))
+        {
+            if (head_.compare_exchange_weak(position, add1(position),
+                std::memory_order_relaxed))
+            {
+                out = cell.value;
+                cell.sequence.store(position + add1(mask_),
+                    std::memory_order_release);
+                return true;
+            }
+        }
+        else if (is_negative(difference))
+        {
+            // The cell has not been written since the last wrap (empty).
+            return false;
+        }
+        else
+        {
+            position = head_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+size_t validation_queue::capacity() const NOEXCEPT
+{
+    return add1(mask_);
+}
+
+size_t validation_queue::to_size(size_t capacity) NOEXCEPT
+{
+    auto size = two;
+    while (size < capacity)
+        size <<= one;
+
+    return size;
+}
+
+BC_POP_WARNING()
+
+} // namespace node
+} // namespace libbitcoin
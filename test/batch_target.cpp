@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "test.hpp"
+
+BOOST_AUTO_TEST_SUITE(batch_target_tests)
+
+BOOST_AUTO_TEST_CASE(batch_target__construct__maximum)
+{
+    const batch_target instance{ 100'000, 10'000 };
+    BOOST_REQUIRE_EQUAL(instance.get(), 100'000u);
+}
+
+BOOST_AUTO_TEST_CASE(batch_target__adapt__disabled__unchanged)
+{
+    batch_target instance{ 100'000, 10'000 };
+    BOOST_REQUIRE(!instance.adapt(100'000, 10'000, 0));
+    BOOST_REQUIRE(!instance.adapt(0, 10'000, 1'000));
+    BOOST_REQUIRE_EQUAL(instance.get(), 100'000u);
+}
+
+BOOST_AUTO_TEST_CASE(batch_target__adapt__within_latency_at_maximum__unchanged)
+{
+    batch_target instance{ 100'000, 10'000 };
+    BOOST_REQUIRE(!instance.adapt(100'000, 500, 1'000));
+    BOOST_REQUIRE_EQUAL(instance.get(), 100'000u);
+}
+
+BOOST_AUTO_TEST_CASE(batch_target__adapt__over_latency__reduced_toward_rate)
+{
+    // 100'000 sigs in 4 secs is 25'000 sps, fitting 25'000 in 1 sec.
+    // Smoothed: (3 * 100'000 + 25'000) / 4 = 81'250.
+    batch_target instance{ 100'000, 10'000 };
+    BOOST_REQUIRE(instance.adapt(100'000, 4'000, 1'000));
+    BOOST_REQUIRE_EQUAL(instance.get(), 81'250u);
+}
+
+BOOST_AUTO_TEST_CASE(batch_target__adapt__over_latency__bounded_by_minimum)
+{
+    batch_target instance{ 100'000, 10'000 };
+    for (auto drain = 0; drain < 20; ++drain)
+        instance.adapt(1'000, 10'000, 1'000);
+
+    BOOST_REQUIRE_EQUAL(instance.get(), 10'000u);
+}
+
+BOOST_AUTO_TEST_CASE(batch_target__adapt__slow_drain__recovers_to_maximum)
+{
+    batch_target instance{ 100'000, 10'000 };
+    BOOST_REQUIRE(instance.adapt(10'000, 10'000, 1'000));
+    const auto reduced = instance.get();
+    BOOST_REQUIRE_LT(reduced, 100'000u);
+
+    // Smaller (faster) drains within the bound do not reduce the target.
+    auto prior = reduced;
+    for (auto drain = 0; drain < 40; ++drain)
+    {
+        instance.adapt(reduced, 100, 1'000);
+        BOOST_REQUIRE_GE(instance.get(), prior);
+        prior = instance.get();
+    }
+
+    BOOST_REQUIRE_EQUAL(instance.get(), 100'000u);
+}
+
+BOOST_AUTO_TEST_CASE(batch_target__construct__minimum_above_maximum__maximum)
+{
+    batch_target instance{ 5'000, 10'000 };
+    instance.adapt(1'000, 10'000, 1'000);
+    BOOST_REQUIRE_EQUAL(instance.get(), 5'000u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
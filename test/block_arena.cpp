@@ -18,6 +18,8 @@
  */
 #include "test.hpp"
 
+#include <thread>
+
 BOOST_AUTO_TEST_SUITE(block_arena_tests)
 
 using namespace system;
@@ -159,6 +161,48 @@ public:
     }
 };
 
+class recycle_accessor
+  : public block_arena
+{
+public:
+    using block_arena::block_arena;
+
+    bool get_hugepages() const NOEXCEPT
+    {
+        return hugepages_;
+    }
+
+    bool get_recycle() const NOEXCEPT
+    {
+        return recycle_;
+    }
+
+    size_t get_high_water() const NOEXCEPT
+    {
+        return high_water_;
+    }
+
+    size_t get_chunks() const NOEXCEPT
+    {
+        return chunks_.size();
+    }
+
+    size_t get_size() const NOEXCEPT
+    {
+        return size_;
+    }
+
+    static constexpr size_t granularity() NOEXCEPT
+    {
+        return chunk_granularity - chunk_offset;
+    }
+
+    static constexpr size_t hugepage() NOEXCEPT
+    {
+        return hugepage_size - chunk_offset;
+    }
+};
+
 // construct
 
 BOOST_AUTO_TEST_CASE(block_arena__construct__zero__sets_zero)
@@ -647,4 +691,265 @@ BOOST_AUTO_TEST_CASE(block_arena__do_is_equal__unequal__false)
     BOOST_REQUIRE(!instance1.is_equal(instance2));
 }
 
+// adaptive sizing
+
+BOOST_AUTO_TEST_CASE(block_arena__start__unsampled__multiple_of_wire_size)
+{
+    accessor instance{ 20 };
+    const auto memory = instance.start(100);
+    BOOST_REQUIRE_EQUAL(instance.get_size(), 2000u);
+    instance.detach();
+    instance.release(memory);
+}
+
+BOOST_AUTO_TEST_CASE(block_arena__start__sampled__percentile_of_observed_ratio)
+{
+    constexpr auto wire = 100u;
+    constexpr auto bytes = 300u;
+    accessor instance{ 20 };
+
+    // Ratio is (300 + 8) / 100, sampled in eighths (rounded up) as 25/8.
+    for (auto sample = zero; sample < 32u; ++sample)
+    {
+        const auto memory = instance.start(wire);
+        BOOST_REQUIRE_EQUAL(instance.get_size(), 2000u);
+        BOOST_REQUIRE_NE(instance.allocate(bytes, 1), nullptr);
+        BOOST_REQUIRE_EQUAL(instance.detach(), link_size + bytes);
+        instance.release(memory);
+    }
+
+    const auto memory = instance.start(wire);
+    BOOST_REQUIRE_EQUAL(instance.get_size(), 313u);
+    BOOST_REQUIRE_GE(instance.get_size(), link_size + bytes);
+    instance.detach();
+    instance.release(memory);
+}
+
+BOOST_AUTO_TEST_CASE(block_arena__get_statistics__started__expected)
+{
+    constexpr auto bytes = 300u;
+    accessor instance{ 20 };
+    const auto memory = instance.start(100);
+    BOOST_REQUIRE_NE(instance.allocate(bytes, 1), nullptr);
+    instance.detach();
+    instance.release(memory);
+
+    const auto statistics = instance.get_statistics();
+    BOOST_REQUIRE_EQUAL(statistics.allocations, one);
+    BOOST_REQUIRE_EQUAL(statistics.chunks, one);
+    BOOST_REQUIRE_EQUAL(statistics.bytes, link_size + bytes);
+    BOOST_REQUIRE_EQUAL(statistics.slack, 2000u - link_size - bytes);
+    BOOST_REQUIRE_EQUAL(statistics.padding, zero);
+    BOOST_REQUIRE_EQUAL(statistics.peak, 2000u);
+}
+
+BOOST_AUTO_TEST_CASE(block_arena__get_statistics__unaligned__expected_padding)
+{
+    accessor instance{ 20 };
+    const auto memory = instance.start(100);
+    BOOST_REQUIRE_NE(instance.allocate(1, 1), nullptr);
+    BOOST_REQUIRE_NE(instance.allocate(8, 8), nullptr);
+    instance.detach();
+    instance.release(memory);
+
+    // link_size + 1 is padded to the next 8 byte boundary.
+    BOOST_REQUIRE_EQUAL(instance.get_statistics().padding, 7u);
+}
+
+BOOST_AUTO_TEST_CASE(block_arena__get_statistics__overlapping__peak_live_bytes)
+{
+    accessor instance{ 20 };
+    const auto memory1 = instance.start(100);
+    instance.detach();
+    const auto memory2 = instance.start(50);
+    instance.detach();
+    instance.release(memory1);
+    instance.release(memory2);
+
+    const auto memory3 = instance.start(100);
+    instance.detach();
+    instance.release(memory3);
+    BOOST_REQUIRE_EQUAL(instance.get_statistics().peak, 2000u + 1000u);
+}
+
+BOOST_AUTO_TEST_CASE(block_arena__get_statistics__unstarted__zeros)
+{
+    accessor instance{ 20 };
+    instance.detach();
+    const auto statistics = instance.get_statistics();
+    BOOST_REQUIRE_EQUAL(statistics.allocations, zero);
+    BOOST_REQUIRE_EQUAL(statistics.chunks, zero);
+    BOOST_REQUIRE_EQUAL(statistics.bytes, zero);
+    BOOST_REQUIRE_EQUAL(statistics.slack, zero);
+    BOOST_REQUIRE_EQUAL(statistics.padding, zero);
+    BOOST_REQUIRE_EQUAL(statistics.peak, zero);
+}
+
+// recycle
+
+BOOST_AUTO_TEST_CASE(block_arena__construct__default__no_recycle)
+{
+    const recycle_accessor instance{ 42 };
+    BOOST_REQUIRE(!instance.get_hugepages());
+    BOOST_REQUIRE(!instance.get_recycle());
+    BOOST_REQUIRE_EQUAL(instance.get_high_water(), zero);
+    BOOST_REQUIRE_EQUAL(instance.get_chunks(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(block_arena__release__recycle__retains_and_reuses_chunk)
+{
+    recycle_accessor instance{ 2, false, true };
+    BOOST_REQUIRE(instance.get_recycle());
+
+    const auto memory1 = instance.start(100);
+    BOOST_REQUIRE_NE(instance.allocate(10, 8), nullptr);
+    instance.detach();
+    BOOST_REQUIRE_EQUAL(instance.get_high_water(), one);
+    instance.release(memory1);
+    BOOST_REQUIRE_EQUAL(instance.get_chunks(), one);
+
+    const auto memory2 = instance.start(100);
+    BOOST_REQUIRE_EQUAL(memory2, memory1);
+    BOOST_REQUIRE_EQUAL(instance.get_chunks(), zero);
+    instance.detach();
+    instance.release(memory2);
+    BOOST_REQUIRE_EQUAL(instance.get_chunks(), one);
+}
+
+BOOST_AUTO_TEST_CASE(block_arena__release__recycle__retains_live_chunks)
+{
+    recycle_accessor instance{ 1, false, true };
+    const auto memory1 = instance.start(100);
+    instance.detach();
+
+    // Concurrently held allocations raise high water to the live count.
+    const auto memory2 = instance.start(100);
+    instance.detach();
+    instance.release(memory1);
+    instance.release(memory2);
+    BOOST_REQUIRE_EQUAL(instance.get_high_water(), two);
+    BOOST_REQUIRE_EQUAL(instance.get_chunks(), two);
+
+    // Both retained chunks are reused by the next concurrent allocations.
+    const auto memory3 = instance.start(100);
+    instance.detach();
+    const auto memory4 = instance.start(100);
+    instance.detach();
+    BOOST_REQUIRE_EQUAL(instance.get_chunks(), zero);
+    instance.release(memory3);
+    instance.release(memory4);
+    BOOST_REQUIRE_EQUAL(instance.get_high_water(), two);
+    BOOST_REQUIRE_EQUAL(instance.get_chunks(), two);
+}
+
+BOOST_AUTO_TEST_CASE(block_arena__release__recycle__bounded_by_high_water)
+{
+    recycle_accessor instance{ 1, false, true };
+    const auto memory1 = instance.start(100);
+    instance.detach();
+    const auto memory2 = instance.start(100);
+    instance.detach();
+
+    // Trim resets high water (zero) so released chunks are discarded.
+    instance.trim();
+    instance.release(memory1);
+    instance.release(memory2);
+    BOOST_REQUIRE_EQUAL(instance.get_high_water(), zero);
+    BOOST_REQUIRE_EQUAL(instance.get_chunks(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(block_arena__trim__recycle__frees_chunks_resets_high_water)
+{
+    recycle_accessor instance{ 2, false, true };
+    const auto memory = instance.start(100);
+    instance.detach();
+    instance.release(memory);
+    BOOST_REQUIRE_EQUAL(instance.get_chunks(), one);
+
+    instance.trim();
+    BOOST_REQUIRE_EQUAL(instance.get_chunks(), zero);
+    BOOST_REQUIRE_EQUAL(instance.get_high_water(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(block_arena__start__recycle__uses_rounded_chunk_capacity)
+{
+    recycle_accessor instance{ 2, false, true };
+    const auto memory = instance.start(100);
+    BOOST_REQUIRE_EQUAL(instance.get_size(), recycle_accessor::granularity());
+
+    // Allocation beyond the requested size fits the rounded chunk.
+    BOOST_REQUIRE_NE(instance.allocate(1000, 8), nullptr);
+    instance.detach();
+    instance.release(memory);
+    BOOST_REQUIRE_EQUAL(instance.get_statistics().chunks, one);
+}
+
+BOOST_AUTO_TEST_CASE(block_arena__idle__outstanding__false_until_released)
+{
+    recycle_accessor instance{ 2, false, true };
+    BOOST_REQUIRE(instance.idle());
+
+    const auto memory = instance.start(100);
+    instance.detach();
+    BOOST_REQUIRE(!instance.idle());
+
+    instance.release(memory);
+    BOOST_REQUIRE(instance.idle());
+}
+
+BOOST_AUTO_TEST_CASE(block_arena__release__other_thread__retained_for_owner)
+{
+    recycle_accessor instance{ 2, false, true };
+    const auto memory1 = instance.start(100);
+    instance.detach();
+
+    std::thread thread([&]() NOEXCEPT
+    {
+        instance.release(memory1);
+    });
+
+    thread.join();
+    BOOST_REQUIRE(instance.idle());
+    BOOST_REQUIRE_EQUAL(instance.get_chunks(), one);
+
+    const auto memory2 = instance.start(100);
+    BOOST_REQUIRE_EQUAL(memory2, memory1);
+    instance.detach();
+    instance.release(memory2);
+}
+
+BOOST_AUTO_TEST_CASE(block_arena__start__hugepages_small__uses_rounded_chunk_capacity)
+{
+    // Chunks smaller than a hugepage are not mapped.
+    recycle_accessor instance{ 2, true };
+    const auto memory = instance.start(100);
+    BOOST_REQUIRE_NE(memory, nullptr);
+    BOOST_REQUIRE_EQUAL(instance.get_size(), recycle_accessor::granularity());
+    instance.detach();
+    instance.release(memory);
+}
+
+BOOST_AUTO_TEST_CASE(block_arena__release__hugepages__retains_and_reuses_chunk)
+{
+    recycle_accessor instance{ 1, true };
+    const auto memory1 = instance.start(recycle_accessor::hugepage());
+    BOOST_REQUIRE_EQUAL(instance.get_size(), recycle_accessor::hugepage());
+    BOOST_REQUIRE_NE(memory1, nullptr);
+    BOOST_REQUIRE_NE(instance.allocate(10, 8), nullptr);
+    instance.detach();
+    instance.release(memory1);
+
+    if (!instance.get_hugepages())
+        return;
+
+    BOOST_REQUIRE(instance.get_recycle());
+    BOOST_REQUIRE_EQUAL(instance.get_chunks(), one);
+    const auto memory2 = instance.start(recycle_accessor::hugepage());
+    BOOST_REQUIRE_EQUAL(memory2, memory1);
+    BOOST_REQUIRE_EQUAL(instance.get_chunks(), zero);
+    instance.detach();
+    instance.release(memory2);
+    BOOST_REQUIRE_EQUAL(instance.get_chunks(), one);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,361 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "test.hpp"
+
+// Block deserialization allocator comparison, compiled when
+// HAVE_PERFORMANCE_TESTS is defined (cmake: with-performance-tests,
+// autotools: --with-performance-tests).
+// Run: libbitcoin-node-test --run_test=block_arena_performance_tests
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory_resource>
+#if defined(HAVE_LINUX)
+    #include <unistd.h>
+#endif
+
+BOOST_AUTO_TEST_SUITE(block_arena_performance_tests)
+
+using namespace system;
+using namespace std::chrono;
+
+// Raw mainnet blocks (*.block) are read from this directory when present.
+const std::filesystem::path corpus_directory{ "blocks" };
+
+constexpr size_t rounds = 100;
+constexpr size_t header_size = 80;
+constexpr std::array<size_t, 6> multiples{ 1, 2, 5, 10, 20, 40 };
+
+struct result
+{
+    size_t blocks{};
+    size_t bytes{};
+    size_t objects{};
+    size_t heap{};
+    size_t peak{};
+    size_t rss{};
+    microseconds elapsed{};
+};
+
+// Counts object allocations and live bytes, forwards to a pmr resource.
+class resource_arena
+  : public arena
+{
+public:
+    resource_arena(std::pmr::memory_resource& resource) NOEXCEPT
+      : resource_(resource)
+    {
+    }
+
+    void* start(size_t) THROWS override
+    {
+        return nullptr;
+    }
+
+    size_t detach() NOEXCEPT override
+    {
+        return live_;
+    }
+
+    void release(void*) NOEXCEPT override
+    {
+    }
+
+    size_t objects() const NOEXCEPT
+    {
+        return objects_;
+    }
+
+    size_t peak() const NOEXCEPT
+    {
+        return peak_;
+    }
+
+protected:
+    void* do_allocate(size_t bytes, size_t align) THROWS override
+    {
+        ++objects_;
+        live_ += bytes;
+        peak_ = std::max(peak_, live_);
+        return resource_.allocate(bytes, align);
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t align) NOEXCEPT override
+    {
+        live_ -= bytes;
+        resource_.deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const arena& other) const NOEXCEPT override
+    {
+        return &other == this;
+    }
+
+private:
+    std::pmr::memory_resource& resource_;
+    size_t objects_{};
+    size_t live_{};
+    size_t peak_{};
+};
+
+// Counts heap allocations and live bytes (monotonic buffer upstream).
+class counting_resource
+  : public std::pmr::memory_resource
+{
+public:
+    size_t allocations() const NOEXCEPT
+    {
+        return allocations_;
+    }
+
+    size_t peak() const NOEXCEPT
+    {
+        return peak_;
+    }
+
+protected:
+    void* do_allocate(size_t bytes, size_t align) override
+    {
+        ++allocations_;
+        live_ += bytes;
+        peak_ = std::max(peak_, live_);
+        return std::pmr::new_delete_resource()->allocate(bytes, align);
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t align) override
+    {
+        live_ -= bytes;
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const memory_resource& other) const NOEXCEPT override
+    {
+        return &other == this;
+    }
+
+private:
+    size_t allocations_{};
+    size_t live_{};
+    size_t peak_{};
+};
+
+// Counts object allocations within the block arena.
+class counting_arena
+  : public block_arena
+{
+public:
+    using block_arena::block_arena;
+
+    size_t objects() const NOEXCEPT
+    {
+        return objects_;
+    }
+
+protected:
+    void* do_allocate(size_t bytes, size_t align) THROWS override
+    {
+        ++objects_;
+        return block_arena::do_allocate(bytes, align);
+    }
+
+private:
+    size_t objects_{};
+};
+
+// Fixture blocks when present, otherwise the mainnet genesis block and two
+// blocks of its coinbase repeated (250 and 2000 transactions).
+static std::vector<data_chunk> get_corpus() NOEXCEPT
+{
+    std::vector<data_chunk> corpus{};
+    if (std::filesystem::is_directory(corpus_directory))
+    {
+        for (const auto& entry:
+            std::filesystem::directory_iterator(corpus_directory))
+        {
+            if (entry.path().extension() != ".block")
+                continue;
+
+            std::ifstream file(entry.path(), std::ios::binary);
+            corpus.emplace_back(std::istreambuf_iterator<char>(file),
+                std::istreambuf_iterator<char>());
+        }
+
+        if (!corpus.empty())
+            return corpus;
+    }
+
+    const system::settings mainnet{ chain::selection::mainnet };
+    const auto genesis = mainnet.genesis_block.to_data(true);
+    const data_slice header{ genesis.begin(),
+        std::next(genesis.begin(), header_size) };
+    const data_slice coinbase{ std::next(genesis.begin(), add1(header_size)),
+        genesis.end() };
+
+    const auto repeat = [&](size_t count, const data_chunk& prefix) NOEXCEPT
+    {
+        auto block = splice(header, prefix);
+        for (size_t tx = 0; tx < count; ++tx)
+            extend(block, coinbase);
+
+        return block;
+    };
+
+    corpus.push_back(genesis);
+    corpus.push_back(repeat(250, { 0xfa }));
+    corpus.push_back(repeat(2000, { 0xfd, 0xd0, 0x07 }));
+    return corpus;
+}
+
+// Current resident set size in KiB (statm reports resident pages second).
+static size_t current_rss() NOEXCEPT
+{
+#if defined(HAVE_LINUX)
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    size_t pages{}, resident{};
+    std::ifstream statm{ "/proc/self/statm" };
+    if (statm >> pages >> resident)
+        return resident * (sign_cast<size_t>(::sysconf(_SC_PAGESIZE)) / 1024u);
+    BC_POP_WARNING()
+#endif
+    return zero;
+}
+
+static void report(const std::string& name, size_t multiple,
+    const result& out) NOEXCEPT
+{
+    const auto micro = greater(to_unsigned(out.elapsed.count()), one);
+    const auto rate = (out.bytes * 1'000'000u) / micro / (1024u * 1024u);
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::cout << (boost_format(
+        "%1% [x%2%] blocks: %3% rate: %4% MiB/s objects: %5% heap: %6% "
+        "peak: %7% bytes rss: +%8% KiB") % name % multiple % out.blocks %
+        rate % out.objects % out.heap % out.peak % out.rss).str()
+        << std::endl;
+    BC_POP_WARNING()
+}
+
+template <typename Deserialize>
+static bool measure(const std::vector<data_chunk>& corpus, result& out,
+    Deserialize&& deserialize) NOEXCEPT
+{
+    auto valid = true;
+    const auto rss = current_rss();
+    const auto start = steady_clock::now();
+    for (size_t round = 0; round < rounds; ++round)
+    {
+        for (const auto& data: corpus)
+        {
+            valid &= deserialize(data);
+            out.bytes += data.size();
+            ++out.blocks;
+        }
+    }
+
+    out.elapsed = duration_cast<microseconds>(steady_clock::now() - start);
+    out.rss = floored_subtract(current_rss(), rss);
+    return valid;
+}
+
+BOOST_AUTO_TEST_CASE(block_arena_performance__block_arena__multiples)
+{
+    const auto corpus = get_corpus();
+    for (const auto recycle: { false, true })
+    {
+        for (const auto multiple: multiples)
+        {
+            result out{};
+            counting_arena memory{ multiple, false, recycle };
+            BOOST_REQUIRE(measure(corpus, out, [&](const data_chunk& data)
+            {
+                stream::in::fast source{ data };
+                read::bytes::fast reader{ source, &memory };
+                const auto begin = memory.start(data.size());
+                const auto block = reader.get_allocator().
+                    new_object<chain::block>(reader, true);
+                memory.detach();
+                memory.release(begin);
+                return !is_null(block) && reader;
+            }));
+
+            const auto statistics = memory.get_statistics();
+            out.objects = memory.objects();
+            out.heap = statistics.chunks;
+            out.peak = statistics.peak;
+            report(recycle ? "block_arena (recycle)" : "block_arena",
+                multiple, out);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(block_arena_performance__monotonic_buffer__multiples)
+{
+    const auto corpus = get_corpus();
+    for (const auto multiple: multiples)
+    {
+        result out{};
+        counting_resource upstream{};
+        BOOST_REQUIRE(measure(corpus, out, [&](const data_chunk& data)
+        {
+            // Initial buffer sized as the block arena first chunk.
+            std::pmr::monotonic_buffer_resource resource
+            {
+                data.size() * multiple, &upstream
+            };
+
+            resource_arena memory{ resource };
+            stream::in::fast source{ data };
+            read::bytes::fast reader{ source, &memory };
+            const auto block = reader.get_allocator().
+                new_object<chain::block>(reader, true);
+            out.objects += memory.objects();
+            return !is_null(block) && reader;
+        }));
+
+        out.heap = upstream.allocations();
+        out.peak = upstream.peak();
+        report("monotonic_buffer_resource", multiple, out);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(block_arena_performance__default_allocator__baseline)
+{
+    const auto corpus = get_corpus();
+    result out{};
+    resource_arena memory{ *std::pmr::new_delete_resource() };
+    BOOST_REQUIRE(measure(corpus, out, [&](const data_chunk& data)
+    {
+        // Block is destructed, each object is individually freed.
+        stream::in::fast source{ data };
+        read::bytes::fast reader{ source, &memory };
+        const chain::block block{ reader, true };
+        return block.is_valid() && reader;
+    }));
+
+    out.objects = memory.objects();
+    out.heap = out.objects;
+    out.peak = memory.peak();
+    report("default", zero, out);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -28,19 +28,28 @@ class accessor
 public:
     using block_memory::block_memory;
 
-    size_t get_count() const NOEXCEPT
+    size_t get_size() const NOEXCEPT
     {
-        return count_;
+        std::unique_lock lock{ registry_->mutex_ };
+        return registry_->arenas_.size();
     }
 
-    size_t get_size() const NOEXCEPT
+    size_t get_unleased() const NOEXCEPT
+    {
+        std::unique_lock lock{ registry_->mutex_ };
+        return registry_->unleased_.size();
+    }
+
+    size_t get_retiring() const NOEXCEPT
     {
-        return arenas_.size();
+        std::unique_lock lock{ registry_->mutex_ };
+        return registry_->retiring_.size();
     }
 
     arena* get_arena_at(size_t index) NOEXCEPT
     {
-        return &arenas_.at(index);
+        std::unique_lock lock{ registry_->mutex_ };
+        return &registry_->arenas_.at(index);
     }
 };
 
@@ -50,8 +59,8 @@ BOOST_AUTO_TEST_CASE(block_memory__get_arena__no_multiple_no_threads__default_ar
     constexpr size_t threads = 0;
     accessor instance{ multiple, threads };
     BOOST_REQUIRE_EQUAL(instance.get_size(), zero);
-    BOOST_REQUIRE_EQUAL(instance.get_count(), zero);
     BOOST_REQUIRE_EQUAL(instance.get_arena(), default_arena::get());
+    BOOST_REQUIRE_EQUAL(instance.fallbacks(), zero);
 }
 
 BOOST_AUTO_TEST_CASE(block_memory__get_arena__no_threads__default_arena)
@@ -60,8 +69,8 @@ BOOST_AUTO_TEST_CASE(block_memory__get_arena__no_threads__default_arena)
     constexpr size_t threads = 0;
     accessor instance{ multiple, threads };
     BOOST_REQUIRE_EQUAL(instance.get_size(), zero);
-    BOOST_REQUIRE_EQUAL(instance.get_count(), zero);
     BOOST_REQUIRE_EQUAL(instance.get_arena(), default_arena::get());
+    BOOST_REQUIRE_EQUAL(instance.fallbacks(), zero);
 }
 
 BOOST_AUTO_TEST_CASE(block_memory__get_arena__no_multiple__default_arena)
@@ -70,8 +79,8 @@ BOOST_AUTO_TEST_CASE(block_memory__get_arena__no_multiple__default_arena)
     constexpr size_t threads = 1;
     accessor instance{ multiple, threads };
     BOOST_REQUIRE_EQUAL(instance.get_size(), zero);
-    BOOST_REQUIRE_EQUAL(instance.get_count(), zero);
     BOOST_REQUIRE_EQUAL(instance.get_arena(), default_arena::get());
+    BOOST_REQUIRE_EQUAL(instance.fallbacks(), zero);
 }
 
 BOOST_AUTO_TEST_CASE(block_memory__get_arena__multiple_one_thread__not_default_arena)
@@ -80,23 +89,35 @@ BOOST_AUTO_TEST_CASE(block_memory__get_arena__multiple_one_thread__not_default_a
     constexpr size_t threads = 1;
     accessor instance{ multiple, threads };
     BOOST_REQUIRE_EQUAL(instance.get_size(), one);
-    BOOST_REQUIRE_EQUAL(instance.get_count(), zero);
-    BOOST_REQUIRE_NE(instance.get_arena(), default_arena::get());
+    BOOST_REQUIRE_EQUAL(instance.get_unleased(), one);
+    BOOST_REQUIRE_EQUAL(instance.get_arena(), instance.get_arena_at(0));
+    BOOST_REQUIRE_EQUAL(instance.get_unleased(), zero);
 }
 
-BOOST_AUTO_TEST_CASE(block_memory__get_arena__multiple_threads__count_unincremented)
+BOOST_AUTO_TEST_CASE(block_memory__get_arena__same_thread__same_arena)
 {
     constexpr size_t multiple = 42;
     constexpr size_t threads = 2;
     accessor instance{ multiple, threads };
     BOOST_REQUIRE_EQUAL(instance.get_size(), two);
 
-    // On any given thread count must not change.
-    BOOST_REQUIRE_EQUAL(instance.get_count(), zero);
-    BOOST_REQUIRE_NE(instance.get_arena(), default_arena::get());
-    BOOST_REQUIRE_EQUAL(instance.get_count(), zero);
-    BOOST_REQUIRE_NE(instance.get_arena(), default_arena::get());
-    BOOST_REQUIRE_EQUAL(instance.get_count(), zero);
+    // On any given thread the lease must not change.
+    const auto arena = instance.get_arena();
+    BOOST_REQUIRE_NE(arena, default_arena::get());
+    BOOST_REQUIRE_EQUAL(instance.get_unleased(), one);
+    BOOST_REQUIRE_EQUAL(instance.get_arena(), arena);
+    BOOST_REQUIRE_EQUAL(instance.get_unleased(), one);
+}
+
+BOOST_AUTO_TEST_CASE(block_memory__get_arena__two_instances__independent_arenas)
+{
+    constexpr size_t multiple = 42;
+    constexpr size_t threads = 1;
+    accessor instance1{ multiple, threads };
+    accessor instance2{ multiple, threads };
+    BOOST_REQUIRE_EQUAL(instance1.get_arena(), instance1.get_arena_at(0));
+    BOOST_REQUIRE_EQUAL(instance2.get_arena(), instance2.get_arena_at(0));
+    BOOST_REQUIRE_NE(instance1.get_arena(), instance2.get_arena());
 }
 
 BOOST_AUTO_TEST_CASE(block_memory__get_arena__two_threads__independent_not_default_arenas)
@@ -105,19 +126,15 @@ BOOST_AUTO_TEST_CASE(block_memory__get_arena__two_threads__independent_not_defau
     constexpr size_t multiple = 42;
     constexpr size_t threads = 2;
     accessor instance{ multiple, threads };
-    size_t count1{};
-    size_t count2{};
     void* arena1{};
     void* arena2{};
 
     std::thread thread1([&]() NOEXCEPT
     {
-        count1 = instance.get_count();
         arena1 = instance.get_arena();
 
         std::thread thread2([&]() NOEXCEPT
         {
-            count2 = instance.get_count();
             arena2 = instance.get_arena();
         });
             
@@ -129,20 +146,79 @@ BOOST_AUTO_TEST_CASE(block_memory__get_arena__two_threads__independent_not_defau
     BOOST_REQUIRE_NE(arena2, default_arena::get());
     BOOST_REQUIRE_NE(arena1, default_arena::get());
     BOOST_REQUIRE_NE(arena1, arena2);
-    BOOST_REQUIRE_NE(count1, count2);
 }
 
-BOOST_AUTO_TEST_CASE(block_memory__get_arena__overflow_threads__default_arena)
+BOOST_AUTO_TEST_CASE(block_memory__get_arena__thread_exit__reclaims_arena)
 {
     constexpr size_t multiple = 42;
-    constexpr size_t threads = 2;
+    constexpr size_t threads = 1;
+    accessor instance{ multiple, threads };
+    void* arena1{};
+    void* arena2{};
+
+    std::thread thread1([&]() NOEXCEPT
+    {
+        arena1 = instance.get_arena();
+    });
+
+    thread1.join();
+    BOOST_REQUIRE_EQUAL(instance.get_unleased(), one);
+
+    std::thread thread2([&]() NOEXCEPT
+    {
+        arena2 = instance.get_arena();
+    });
+
+    thread2.join();
+
+    // Slot is reused, not grown.
+    BOOST_REQUIRE_EQUAL(arena1, instance.get_arena_at(0));
+    BOOST_REQUIRE_EQUAL(arena2, arena1);
+    BOOST_REQUIRE_EQUAL(instance.get_size(), one);
+    BOOST_REQUIRE_EQUAL(instance.fallbacks(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(block_memory__get_arena__thread_exit_outstanding__retires_until_released)
+{
+    constexpr size_t multiple = 42;
+    constexpr size_t threads = 1;
+    accessor instance{ multiple, threads };
+    arena* arena1{};
+    arena* arena2{};
+    void* memory{};
+
+    // Block outlives its allocating thread.
+    std::thread thread1([&]() NOEXCEPT
+    {
+        arena1 = instance.get_arena();
+        memory = arena1->start(100);
+        arena1->detach();
+    });
+
+    thread1.join();
+    BOOST_REQUIRE_EQUAL(instance.get_unleased(), zero);
+    BOOST_REQUIRE_EQUAL(instance.get_retiring(), one);
+
+    arena1->release(memory);
+    std::thread thread2([&]() NOEXCEPT
+    {
+        arena2 = instance.get_arena();
+    });
+
+    thread2.join();
+
+    // Released arena is reclaimed from retirement, not grown.
+    BOOST_REQUIRE_EQUAL(arena2, arena1);
+    BOOST_REQUIRE_EQUAL(instance.get_size(), one);
+    BOOST_REQUIRE_EQUAL(instance.get_retiring(), zero);
+    BOOST_REQUIRE_EQUAL(instance.get_unleased(), one);
+}
+
+BOOST_AUTO_TEST_CASE(block_memory__get_arena__overflow_threads__grows_then_default_arena)
+{
+    constexpr size_t multiple = 42;
+    constexpr size_t threads = 1;
     accessor instance{ multiple, threads };
-    size_t count1a{};
-    size_t count1b{};
-    size_t count2a{};
-    size_t count2b{};
-    size_t count3a{};
-    size_t count3b{};
     void* arena1{};
     void* arena2{};
     void* arena3{};
@@ -150,21 +226,15 @@ BOOST_AUTO_TEST_CASE(block_memory__get_arena__overflow_threads__default_arena)
     // order is required to ensure third is the overflow.
     std::thread thread1([&]() NOEXCEPT
     {
-        count1a = instance.get_count();
         arena1 = instance.get_arena();
-        count1b = instance.get_count();
 
         std::thread thread2([&]() NOEXCEPT
         {
-            count2a = instance.get_count();
             arena2 = instance.get_arena();
-            count2b = instance.get_count();
 
             std::thread thread3([&]() NOEXCEPT
             {
-                count3a = instance.get_count();
                 arena3 = instance.get_arena();
-                count3b = instance.get_count();
             });
 
             thread3.join();
@@ -175,21 +245,37 @@ BOOST_AUTO_TEST_CASE(block_memory__get_arena__overflow_threads__default_arena)
 
     thread1.join();
 
-    // Arenas are ordered by thread order above.
+    // Arenas are ordered by thread order above, second is grown.
+    BOOST_REQUIRE_EQUAL(instance.get_size(), two);
     BOOST_REQUIRE_EQUAL(arena1, instance.get_arena_at(0));
     BOOST_REQUIRE_EQUAL(arena2, instance.get_arena_at(1));
     BOOST_REQUIRE_NE(arena1, arena2);
 
-    // Index overflows to default arena.
+    // Growth is limited to twice threads, so third falls back.
     BOOST_REQUIRE_EQUAL(arena3, default_arena::get());
+    BOOST_REQUIRE_EQUAL(instance.fallbacks(), one);
+
+    // Both leases are returned upon thread exit.
+    BOOST_REQUIRE_EQUAL(instance.get_unleased(), two);
+}
+
+BOOST_AUTO_TEST_CASE(block_memory__trim__recycled_arena__reuses_after_trim)
+{
+    constexpr size_t multiple = 2;
+    constexpr size_t threads = 1;
+    accessor instance{ multiple, threads, false, true };
+    const auto arena = instance.get_arena_at(0);
+
+    const auto memory = arena->start(100);
+    BOOST_REQUIRE_NE(memory, nullptr);
+    arena->detach();
+    arena->release(memory);
+    BOOST_REQUIRE_NO_THROW(instance.trim());
 
-    // Count reflects total, not the index of the thread.
-    BOOST_REQUIRE_EQUAL(count1a, 0u);
-    BOOST_REQUIRE_EQUAL(count2a, 1u);
-    BOOST_REQUIRE_EQUAL(count3a, 2u);
-    BOOST_REQUIRE_EQUAL(count1b, 1u);
-    BOOST_REQUIRE_EQUAL(count2b, 2u);
-    BOOST_REQUIRE_EQUAL(count3b, 3u);
+    const auto again = arena->start(100);
+    BOOST_REQUIRE_NE(again, nullptr);
+    arena->detach();
+    arena->release(again);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "test.hpp"
+
+BOOST_AUTO_TEST_SUITE(capture_policy_tests)
+
+using report = capture_policy::report;
+
+BOOST_AUTO_TEST_CASE(capture_policy__skip__disabled__false)
+{
+    capture_policy instance{ 0, 10, 10 };
+    report out{};
+    instance.missed(5, 100);
+    BOOST_REQUIRE(!instance.skip(5, out));
+    BOOST_REQUIRE(!instance.skip(15, out));
+    BOOST_REQUIRE(!out.advanced);
+}
+
+BOOST_AUTO_TEST_CASE(capture_policy__skip__below_minimum__false)
+{
+    capture_policy instance{ 50, 10, 10 };
+    report out{};
+    BOOST_REQUIRE(!instance.skip(0, out));
+    instance.missed(5, 9);
+    BOOST_REQUIRE(!instance.skip(10, out));
+    BOOST_REQUIRE(out.advanced);
+    BOOST_REQUIRE(!out.changed);
+    BOOST_REQUIRE_EQUAL(out.total, 9u);
+}
+
+BOOST_AUTO_TEST_CASE(capture_policy__skip__ordered__skips_then_probes)
+{
+    capture_policy instance{ 50, 10, 10 };
+    report out{};
+    BOOST_REQUIRE(!instance.skip(0, out));
+    instance.captured(1, 4);
+    instance.missed(2, 6);
+
+    out = {};
+    BOOST_REQUIRE(instance.skip(10, out));
+    BOOST_REQUIRE(out.changed);
+    BOOST_REQUIRE_EQUAL(out.missed, 6u);
+    BOOST_REQUIRE_EQUAL(out.total, 10u);
+
+    // Skipped range has no samples, next range resumes capture.
+    out = {};
+    BOOST_REQUIRE(!instance.skip(20, out));
+    BOOST_REQUIRE(out.changed);
+}
+
+BOOST_AUTO_TEST_CASE(capture_policy__skip__out_of_order__range_retained)
+{
+    capture_policy instance{ 50, 10, 10 };
+    report out{};
+    BOOST_REQUIRE(!instance.skip(3, out));
+    instance.missed(4, 10);
+    BOOST_REQUIRE(instance.skip(12, out));
+
+    // Late heights of the prior range neither regress nor reset the range.
+    out = {};
+    BOOST_REQUIRE(instance.skip(7, out));
+    BOOST_REQUIRE(!out.advanced);
+    instance.missed(8, 100);
+    BOOST_REQUIRE(instance.skip(9, out));
+    BOOST_REQUIRE(instance.skip(15, out));
+    BOOST_REQUIRE(!out.advanced);
+
+    // Samples of the current range are retained across late heights.
+    instance.missed(16, 10);
+    BOOST_REQUIRE(instance.skip(5, out));
+    out = {};
+    BOOST_REQUIRE(instance.skip(21, out));
+    BOOST_REQUIRE(out.advanced);
+    BOOST_REQUIRE(!out.changed);
+    BOOST_REQUIRE_EQUAL(out.missed, 10u);
+    BOOST_REQUIRE_EQUAL(out.total, 10u);
+}
+
+BOOST_AUTO_TEST_CASE(capture_policy__skip__interleaved__decides_on_minimum)
+{
+    capture_policy instance{ 50, 10, 100 };
+    report out{};
+    for (size_t height = 0; height < 10; ++height)
+    {
+        // Alternate between the current and a late height of a prior range.
+        BOOST_REQUIRE(!instance.skip(height + 10, out));
+        BOOST_REQUIRE(!instance.skip(height, out));
+        instance.missed(height + 10, 10);
+        instance.missed(height, 10);
+    }
+
+    out = {};
+    BOOST_REQUIRE(instance.skip(20, out));
+    BOOST_REQUIRE(out.changed);
+    BOOST_REQUIRE_EQUAL(out.total, 100u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
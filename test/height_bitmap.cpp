@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "test.hpp"
+
+BOOST_AUTO_TEST_SUITE(height_bitmap_tests)
+
+BOOST_AUTO_TEST_CASE(height_bitmap__construct__default__zero_base)
+{
+    const height_bitmap instance{};
+    BOOST_REQUIRE_EQUAL(instance.base(), 0u);
+    BOOST_REQUIRE(instance.get(0));
+    BOOST_REQUIRE(!instance.get(1));
+}
+
+BOOST_AUTO_TEST_CASE(height_bitmap__reset__base__clears_above)
+{
+    height_bitmap instance{};
+    instance.set(1);
+    instance.set(2);
+    instance.reset(100);
+    BOOST_REQUIRE_EQUAL(instance.base(), 100u);
+    BOOST_REQUIRE(instance.get(100));
+    BOOST_REQUIRE(!instance.get(101));
+    BOOST_REQUIRE_EQUAL(instance.advance(), 100u);
+}
+
+BOOST_AUTO_TEST_CASE(height_bitmap__set__at_or_below_base__ignored)
+{
+    height_bitmap instance{};
+    instance.reset(10);
+    instance.set(5);
+    instance.set(10);
+    BOOST_REQUIRE_EQUAL(instance.advance(), 10u);
+    BOOST_REQUIRE_EQUAL(instance.missing(12), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(height_bitmap__advance__gap__stops_below_gap)
+{
+    height_bitmap instance{};
+    instance.reset(10);
+    instance.set(11);
+    instance.set(12);
+    instance.set(14);
+    BOOST_REQUIRE_EQUAL(instance.advance(), 12u);
+    BOOST_REQUIRE(!instance.get(13));
+    BOOST_REQUIRE(instance.get(14));
+
+    instance.set(13);
+    BOOST_REQUIRE_EQUAL(instance.advance(), 14u);
+}
+
+BOOST_AUTO_TEST_CASE(height_bitmap__advance__multiple_words__contiguous_top)
+{
+    height_bitmap instance{};
+    instance.reset(3);
+    for (size_t height = 4; height <= 200; ++height)
+        instance.set(height);
+
+    instance.set(202);
+    BOOST_REQUIRE_EQUAL(instance.advance(), 200u);
+    BOOST_REQUIRE(!instance.get(201));
+    BOOST_REQUIRE(instance.get(202));
+    BOOST_REQUIRE(!instance.get(203));
+
+    instance.set(201);
+    BOOST_REQUIRE_EQUAL(instance.advance(), 202u);
+}
+
+BOOST_AUTO_TEST_CASE(height_bitmap__clear_above__above_base__clears_higher)
+{
+    height_bitmap instance{};
+    instance.set(2);
+    instance.set(3);
+    instance.set(70);
+    instance.set(71);
+    instance.clear_above(70);
+    BOOST_REQUIRE(instance.get(2));
+    BOOST_REQUIRE(instance.get(70));
+    BOOST_REQUIRE(!instance.get(71));
+    BOOST_REQUIRE_EQUAL(instance.base(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(height_bitmap__clear_above__below_base__lowers_base)
+{
+    height_bitmap instance{};
+    for (size_t height = 1; height <= 100; ++height)
+        instance.set(height);
+
+    BOOST_REQUIRE_EQUAL(instance.advance(), 100u);
+    instance.clear_above(42);
+    BOOST_REQUIRE_EQUAL(instance.base(), 42u);
+    BOOST_REQUIRE(instance.get(42));
+    BOOST_REQUIRE(!instance.get(43));
+    BOOST_REQUIRE_EQUAL(instance.advance(), 42u);
+}
+
+BOOST_AUTO_TEST_CASE(height_bitmap__missing__partial__unset_count)
+{
+    height_bitmap instance{};
+    instance.reset(60);
+    instance.set(61);
+    instance.set(63);
+    instance.set(65);
+    instance.set(130);
+    BOOST_REQUIRE_EQUAL(instance.advance(), 61u);
+    BOOST_REQUIRE_EQUAL(instance.missing(61), 0u);
+    BOOST_REQUIRE_EQUAL(instance.missing(62), 1u);
+    BOOST_REQUIRE_EQUAL(instance.missing(65), 2u);
+    BOOST_REQUIRE_EQUAL(instance.missing(130), 66u);
+    BOOST_REQUIRE_EQUAL(instance.missing(200), 136u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
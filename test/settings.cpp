@@ -36,17 +36,27 @@ BOOST_AUTO_TEST_CASE(settings__node__default_context__expected)
     BOOST_REQUIRE_EQUAL(node.memory_priority, true);
     BOOST_REQUIRE_EQUAL(node.thread_priority, true);
     BOOST_REQUIRE_EQUAL(node.allow_overlapped, true);
+    BOOST_REQUIRE_EQUAL(node.allocation_hugepages, false);
+    BOOST_REQUIRE_EQUAL(node.allocation_recycle, true);
     BOOST_REQUIRE_EQUAL(node.minimum_fee_rate, 0.0);
     BOOST_REQUIRE_EQUAL(node.minimum_bump_rate, 0.0);
     BOOST_REQUIRE_EQUAL(node.allowed_deviation, 1.5);
     BOOST_REQUIRE_EQUAL(node.batch_signatures, 0_u64);
+    BOOST_REQUIRE_EQUAL(node.batch_thread_bytes, 0_u64);
+    BOOST_REQUIRE_EQUAL(node.batch_latency_seconds, 0_u16);
+    BOOST_REQUIRE_EQUAL(node.batch_miss_percent, 0_u16);
+    BOOST_REQUIRE_EQUAL(node.allocation_multiple, 20_u16);
     BOOST_REQUIRE_EQUAL(node.announcement_cache, 42_u16);
+    BOOST_REQUIRE_EQUAL(node.prefetch_threads, 0_u16);
+    BOOST_REQUIRE_EQUAL(node.prefetch_distance, 64_u32);
+    BOOST_REQUIRE_EQUAL(node.validation_tile, 0_u16);
     BOOST_REQUIRE_EQUAL(node.fee_estimate_horizon, 0u);
     BOOST_REQUIRE_EQUAL(node.maximum_height, 0_u32);
     BOOST_REQUIRE_EQUAL(node.maximum_height_(), max_size_t);
     BOOST_REQUIRE_EQUAL(node.silent_start_height, 0xffffffff_u32);
     BOOST_REQUIRE_EQUAL(node.maximum_concurrency, 50000_u32);
     BOOST_REQUIRE_EQUAL(node.maximum_concurrency_(), 50000_size);
+    BOOST_REQUIRE_EQUAL(node.endgame_blocks, 0_u32);
     BOOST_REQUIRE_EQUAL(node.sample_period_seconds, 10_u16);
     BOOST_REQUIRE_EQUAL(node.currency_window_minutes, 1440_u32);
     BOOST_REQUIRE_EQUAL(node.warn_dirty_background_ratio, 90_u16);
@@ -61,6 +71,8 @@ BOOST_AUTO_TEST_CASE(settings__node__default_context__expected)
     BOOST_REQUIRE_EQUAL(node.fee_estimate_horizon_(), 0_size);
     BOOST_REQUIRE(!node.fee_estimate_enabled());
     BOOST_REQUIRE(!node.batch_signatures_enabled());
+    BOOST_REQUIRE(node.allocation_enabled());
+    BOOST_REQUIRE(!node.prefetch_enabled());
     BOOST_REQUIRE(node.sample_period() == steady_clock::duration(seconds(10)));
     BOOST_REQUIRE(node.currency_window() == steady_clock::duration(minutes(1440)));
     BOOST_REQUIRE(node.thread_priority_() == network::processing_priority::high);
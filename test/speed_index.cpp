@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "test.hpp"
+
+BOOST_AUTO_TEST_SUITE(speed_index_tests)
+
+BOOST_AUTO_TEST_CASE(speed_index__construct__default__empty)
+{
+    const speed_index instance{};
+    object_key out{};
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.sum(), 0.0);
+    BOOST_REQUIRE_EQUAL(instance.mean(), 0.0);
+    BOOST_REQUIRE_EQUAL(instance.variance(), 0.0);
+    BOOST_REQUIRE(!instance.slowest(out));
+}
+
+BOOST_AUTO_TEST_CASE(speed_index__set__new_channels__sums)
+{
+    speed_index instance{};
+    instance.set(1, 2.0);
+    instance.set(2, 4.0);
+    instance.set(3, 6.0);
+    BOOST_REQUIRE_EQUAL(instance.size(), 3u);
+    BOOST_REQUIRE(instance.contains(2));
+    BOOST_REQUIRE(!instance.contains(4));
+    BOOST_REQUIRE_EQUAL(instance.speed(2), 4.0);
+    BOOST_REQUIRE_EQUAL(instance.speed(4), 0.0);
+    BOOST_REQUIRE_EQUAL(instance.sum(), 12.0);
+    BOOST_REQUIRE_EQUAL(instance.mean(), 4.0);
+    BOOST_REQUIRE_EQUAL(instance.variance(), 4.0);
+}
+
+BOOST_AUTO_TEST_CASE(speed_index__set__existing_channel__replaces)
+{
+    speed_index instance{};
+    instance.set(1, 2.0);
+    instance.set(2, 4.0);
+    instance.set(1, 8.0);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE_EQUAL(instance.speed(1), 8.0);
+    BOOST_REQUIRE_EQUAL(instance.sum(), 12.0);
+    BOOST_REQUIRE_EQUAL(instance.mean(), 6.0);
+    BOOST_REQUIRE_EQUAL(instance.variance(), 8.0);
+}
+
+BOOST_AUTO_TEST_CASE(speed_index__slowest__updated__lowest_speed)
+{
+    speed_index instance{};
+    instance.set(1, 5.0);
+    instance.set(2, 3.0);
+    instance.set(3, 9.0);
+
+    object_key out{};
+    BOOST_REQUIRE(instance.slowest(out));
+    BOOST_REQUIRE_EQUAL(out, 2u);
+
+    instance.set(2, 10.0);
+    BOOST_REQUIRE(instance.slowest(out));
+    BOOST_REQUIRE_EQUAL(out, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(speed_index__erase__present__removed)
+{
+    speed_index instance{};
+    instance.set(1, 5.0);
+    instance.set(2, 3.0);
+    BOOST_REQUIRE(instance.erase(2));
+    BOOST_REQUIRE(!instance.erase(2));
+    BOOST_REQUIRE(!instance.contains(2));
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.sum(), 5.0);
+    BOOST_REQUIRE_EQUAL(instance.variance(), 0.0);
+
+    object_key out{};
+    BOOST_REQUIRE(instance.slowest(out));
+    BOOST_REQUIRE_EQUAL(out, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(speed_index__erase__last__resets_sums)
+{
+    speed_index instance{};
+    instance.set(1, 0.1);
+    instance.set(1, 0.7);
+    BOOST_REQUIRE(instance.erase(1));
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.sum(), 0.0);
+    BOOST_REQUIRE_EQUAL(instance.mean(), 0.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "test.hpp"
+
+#include <thread>
+
+BOOST_AUTO_TEST_SUITE(validation_queue_tests)
+
+using job = validation_queue::job;
+
+BOOST_AUTO_TEST_CASE(validation_queue__capacity__zero__two)
+{
+    const validation_queue instance{ 0 };
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(validation_queue__capacity__non_power__next_power)
+{
+    const validation_queue instance{ 1000 };
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 1024u);
+}
+
+BOOST_AUTO_TEST_CASE(validation_queue__capacity__power__unchanged)
+{
+    const validation_queue instance{ 64 };
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 64u);
+}
+
+BOOST_AUTO_TEST_CASE(validation_queue__pop__empty__false)
+{
+    validation_queue instance{ 4 };
+    job out{};
+    BOOST_REQUIRE(!instance.pop(out));
+}
+
+BOOST_AUTO_TEST_CASE(validation_queue__push_pop__ordered__fifo)
+{
+    validation_queue instance{ 4 };
+    BOOST_REQUIRE(instance.push({ 1, false }));
+    BOOST_REQUIRE(instance.push({ 2, true }));
+    BOOST_REQUIRE(instance.push({ 3, false }));
+
+    job out{};
+    BOOST_REQUIRE(instance.pop(out));
+    BOOST_REQUIRE_EQUAL(out.link, 1u);
+    BOOST_REQUIRE(!out.bypass);
+    BOOST_REQUIRE(instance.pop(out));
+    BOOST_REQUIRE_EQUAL(out.link, 2u);
+    BOOST_REQUIRE(out.bypass);
+    BOOST_REQUIRE(instance.pop(out));
+    BOOST_REQUIRE_EQUAL(out.link, 3u);
+    BOOST_REQUIRE(!instance.pop(out));
+}
+
+BOOST_AUTO_TEST_CASE(validation_queue__push__full__false)
+{
+    validation_queue instance{ 2 };
+    BOOST_REQUIRE(instance.push({ 1, false }));
+    BOOST_REQUIRE(instance.push({ 2, false }));
+    BOOST_REQUIRE(!instance.push({ 3, false }));
+
+    job out{};
+    BOOST_REQUIRE(instance.pop(out));
+    BOOST_REQUIRE(instance.push({ 3, false }));
+    BOOST_REQUIRE(!instance.push({ 4, false }));
+}
+
+BOOST_AUTO_TEST_CASE(validation_queue__push_pop__wrapped__fifo)
+{
+    validation_queue instance{ 2 };
+    job out{};
+    for (uint32_t link = 0; link < 10; ++link)
+    {
+        BOOST_REQUIRE(instance.push({ link, false }));
+        BOOST_REQUIRE(instance.pop(out));
+        BOOST_REQUIRE_EQUAL(out.link, link);
+    }
+
+    BOOST_REQUIRE(!instance.pop(out));
+}
+
+BOOST_AUTO_TEST_CASE(validation_queue__push_pop__concurrent__all_consumed_once)
+{
+    constexpr size_t count = 10000;
+    constexpr size_t producers = 2;
+    constexpr size_t consumers = 2;
+    validation_queue instance{ 64 };
+    std::atomic_size_t consumed{};
+    std::atomic<uint64_t> sum{};
+
+    std::vector<std::thread> threads{};
+    for (size_t producer = 0; producer < producers; ++producer)
+    {
+        threads.emplace_back([&, producer]() NOEXCEPT
+        {
+            for (auto index = producer; index < count; index += producers)
+                while (!instance.push({ possible_narrow_cast<uint32_t>(index),
+                    false }))
+                    std::this_thread::yield();
+        });
+    }
+
+    for (size_t consumer = 0; consumer < consumers; ++consumer)
+    {
+        threads.emplace_back([&]() NOEXCEPT
+        {
+            job out{};
+            while (consumed.load() < count)
+            {
+                if (instance.pop(out))
+                {
+                    sum += out.link.value;
+                    ++consumed;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& thread: threads)
+        thread.join();
+
+    BOOST_REQUIRE_EQUAL(consumed.load(), count);
+    BOOST_REQUIRE_EQUAL(sum.load(), (count * sub1(count)) / two);
+}
+
+BOOST_AUTO_TEST_SUITE_END()